@@ -0,0 +1,475 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Job5.hpp"
+#include <Core/Enum/Lead.hpp>
+#include <Core/Enum/Method.hpp>
+#include <Core/Gen5/Encounters5.hpp>
+#include <Core/Gen5/Generators/IDGenerator5.hpp>
+#include <Core/Gen5/Generators/StaticGenerator5.hpp>
+#include <Core/Gen5/Searchers/IDSearcher5.hpp>
+#include <Core/Gen5/Searchers/IVSearcher5.hpp>
+#include <Core/Gen5/Searchers/SearchStore5.hpp>
+#include <Core/Gen5/Searchers/SeedTableSearcher.hpp>
+#include <Core/Gen5/SeedTable.hpp>
+#include <Core/Gen5/States/State5.hpp>
+#include <Core/Parents/Filters/IDFilter.hpp>
+#include <Core/Parents/Filters/StateFilter.hpp>
+#include <Core/Parents/ProfileLoader.hpp>
+#include <Core/Parents/States/IDState.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+using json = nlohmann::json;
+
+/**
+ * @brief Reads a date in the "YYYY-MM-DD" format
+ *
+ * @param j JSON string
+ *
+ * @return Date
+ */
+static Date getDate(const json &j)
+{
+    std::string text = j.get<std::string>();
+
+    unsigned year, month, day;
+    if (std::sscanf(text.c_str(), "%u-%u-%u", &year, &month, &day) != 3 || year < 2000 || year > 2099 || month < 1 || month > 12 || day < 1
+        || day > Date::daysInMonth(year, month))
+    {
+        throw std::invalid_argument("Invalid date: " + text);
+    }
+
+    return Date(year, month, day);
+}
+
+/**
+ * @brief Builds the fingerprint that identifies the search of a job in a result store. The date and Timer0 ranges are tracked by
+ * the store, so they are left out together with the output settings and the profile fields that do not change results.
+ *
+ * @param job Job description
+ * @param profile Profile information
+ *
+ * @return Search fingerprint
+ */
+static std::string getFingerprint(const json &job, const Profile5 &profile)
+{
+    json fingerprint = job;
+    for (const char *key : { "end", "format", "output", "start", "store", "threads" })
+    {
+        fingerprint.erase(key);
+    }
+
+    json &j = fingerprint["profile"] = json::parse(ProfileLoader5::toJson(profile));
+    for (const char *key : { "ivCache", "name", "shaCache", "timer0Max", "timer0Min" })
+    {
+        j.erase(key);
+    }
+    return fingerprint.dump();
+}
+
+/**
+ * @brief Reads the ID filter of a job
+ *
+ * @param j JSON filter
+ *
+ * @return ID filter
+ */
+static IDFilter getIDFilter(const json &j)
+{
+    auto getPairs = [&j](const char *key) {
+        std::vector<std::pair<u16, u16>> pairs;
+        for (const auto &pair : j.value(key, json::array()))
+        {
+            pairs.emplace_back(pair.at(0).get<u16>(), pair.at(1).get<u16>());
+        }
+        return pairs;
+    };
+
+    return IDFilter(j.value("tid", std::vector<u16>()), j.value("sid", std::vector<u16>()), getPairs("tidSID"),
+                    j.value("tsv", std::vector<u16>()), getPairs("tidTSV"), j.value("display", std::vector<u32>()));
+}
+
+/**
+ * @brief Reads a generator seed given as a number or hex string
+ *
+ * @param j JSON seed
+ *
+ * @return Seed
+ */
+static u64 getSeed(const json &j)
+{
+    if (j.is_string())
+    {
+        return std::stoull(j.get<std::string>(), nullptr, 16);
+    }
+    return j.get<u64>();
+}
+
+/**
+ * @brief Reads the Pokemon filter of a job. Fields that are missing do not filter anything.
+ *
+ * @param j JSON filter
+ *
+ * @return Pokemon filter
+ */
+static StateFilter getStateFilter(const json &j)
+{
+    std::array<bool, 25> natures;
+    natures.fill(!j.contains("natures"));
+    for (u8 nature : j.value("natures", json::array()))
+    {
+        natures.at(nature) = true;
+    }
+
+    std::array<bool, 16> powers;
+    powers.fill(!j.contains("powers"));
+    for (u8 power : j.value("powers", json::array()))
+    {
+        powers.at(power) = true;
+    }
+
+    return StateFilter(j.value("gender", 255), j.value("ability", 255), j.value("shiny", 255), j.value("levelMin", 0),
+                       j.value("levelMax", 100), j.value("heightMin", 0), j.value("heightMax", 255), j.value("weightMin", 0),
+                       j.value("weightMax", 255), j.value("skip", false), j.value("ivMin", std::array<u8, 6> { 0, 0, 0, 0, 0, 0 }),
+                       j.value("ivMax", std::array<u8, 6> { 31, 31, 31, 31, 31, 31 }), natures, powers);
+}
+
+/**
+ * @brief Reads the static encounter of a job
+ *
+ * @param j JSON parameters
+ *
+ * @return Static encounter
+ */
+static const StaticTemplate5 *getStaticTemplate(const json &j)
+{
+    int category = j.at("category").get<int>();
+    int pokemon = j.at("pokemon").get<int>();
+    if (category < 0 || category > 8)
+    {
+        throw std::invalid_argument("Invalid static category");
+    }
+
+    int size;
+    Encounters5::getStaticEncounters(category, &size);
+    if (pokemon < 0 || pokemon >= size)
+    {
+        throw std::invalid_argument("Invalid static pokemon");
+    }
+
+    return Encounters5::getStaticEncounter(category, pokemon);
+}
+
+/**
+ * @brief Writes the search progress to stderr
+ *
+ * @param progress Search progress in percent
+ * @param results Number of results written so far
+ */
+static void reportProgress(int progress, u64 results)
+{
+    std::cerr << "{\"progress\":" << progress << ",\"results\":" << results << "}" << std::endl;
+}
+
+/**
+ * @brief Runs the \p searcher over the \p shard and passes its results to \p callback as they are found
+ *
+ * @tparam Searcher Searcher class
+ * @tparam Callback Callback class
+ * @param searcher Searcher
+ * @param threads Number of threads
+ * @param shard Search shard
+ * @param callback Function that receives the results
+ */
+template <class Searcher, class Callback>
+static void runSearch(Searcher &searcher, int threads, const SearchShard5 &shard, Callback callback)
+{
+    std::atomic<bool> finished = false;
+    std::thread thread([&] {
+        searcher.startSearch(threads, shard);
+        finished = true;
+    });
+
+    while (!finished)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        callback(searcher.getResults());
+    }
+
+    thread.join();
+    callback(searcher.getResults());
+}
+
+/**
+ * @brief Searches the \p shard and writes its results. With a \p store only the part of the shard the store does not cover is
+ * searched, and the results are written once they have been combined with the stored results.
+ *
+ * @tparam State State class
+ * @tparam Searcher Searcher class
+ * @param searcher Searcher
+ * @param threads Number of threads
+ * @param shard Search shard
+ * @param store Result store, or nullptr to stream the results
+ * @param writer Result writer
+ */
+template <class State, class Searcher>
+static void search(Searcher &searcher, int threads, const SearchShard5 &shard, SearchStore5 *store,
+                   ResultWriter<SearcherState5<State>> &writer)
+{
+    if (!store)
+    {
+        searcher.setMaxProgress(std::max<u64>(searcher.getMaxProgress(shard), 1));
+        runSearch(searcher, threads, shard, [&](const std::vector<SearcherState5<State>> &results) {
+            writer.write(results);
+            reportProgress(searcher.getProgress(), writer.getCount());
+        });
+        return;
+    }
+
+    std::vector<SearchShard5> missing = store->getMissing(shard);
+
+    u64 maxProgress = 0;
+    for (const auto &part : missing)
+    {
+        maxProgress += searcher.getMaxProgress(part);
+    }
+    searcher.setMaxProgress(std::max<u64>(maxProgress, 1));
+
+    u64 found = 0;
+    for (const auto &part : missing)
+    {
+        std::vector<SearcherState5<State>> results;
+        runSearch(searcher, threads, part, [&](const std::vector<SearcherState5<State>> &data) {
+            results.insert(results.end(), data.begin(), data.end());
+            reportProgress(searcher.getProgress(), found + results.size());
+        });
+
+        found += results.size();
+        if (!store->add<State>(part, results))
+        {
+            throw std::runtime_error("Unable to write the result store");
+        }
+    }
+
+    writer.write(store->read<State>(shard));
+}
+
+/**
+ * @brief Builds the seed table of the \p profile from \p start to \p end
+ *
+ * @param path Path of the table
+ * @param profile Profile information
+ * @param start Start date
+ * @param end End date
+ * @param threads Number of threads
+ */
+static void buildSeedTable(const std::string &path, const Profile5 &profile, const Date &start, const Date &end, int threads)
+{
+    if (SeedTable::getSize(profile, start, end) > SeedTable::maxSize)
+    {
+        throw std::invalid_argument("Date range has too many seeds for a seed table");
+    }
+
+    SeedTableSearcher searcher(profile, start, end);
+    searcher.setMaxProgress(searcher.getMaxProgress());
+
+    std::atomic<bool> finished = false;
+    std::thread thread([&] {
+        searcher.startSearch(threads);
+        finished = true;
+    });
+
+    while (!finished)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        reportProgress(searcher.getProgress(), 0);
+    }
+    thread.join();
+
+    if (!searcher.writeResults(path))
+    {
+        throw std::runtime_error("Unable to write " + path);
+    }
+}
+
+namespace Job5
+{
+    bool merge(const SearchManifest5 &manifest, const std::vector<std::string> &inputs, const std::string &output)
+    {
+        std::string type = json::parse(manifest.job).at("type").get<std::string>();
+        if (type == "id5")
+        {
+            return SearchShards5::mergeResults<IDState>(inputs, output);
+        }
+        else if (type == "static5")
+        {
+            return SearchShards5::mergeResults<State5>(inputs, output);
+        }
+        throw std::invalid_argument("Unknown job type: " + type);
+    }
+
+    void run(const json &job, const SearchShard5 *shard, std::ostream &stream, OutputFormat format, bool seekable)
+    {
+        Profile5 profile = ProfileLoader5::fromJson(job.at("profile").dump());
+        std::string type = job.at("type").get<std::string>();
+        bool searching = job.value("mode", "search") == "search";
+        int threads = std::max(job.value("threads", static_cast<int>(std::thread::hardware_concurrency())), 1);
+        json parameters = job.value("parameters", json::object());
+        json filter = job.value("filter", json::object());
+
+        // A search without a shard covers the whole date range of the job. Only whole searches use the result store, because the
+        // store expects every search to cover all keypresses.
+        SearchShard5 full;
+        std::string storeDirectory;
+        if (searching && !shard)
+        {
+            full = SearchShards5::split(profile, getDate(job.at("start")), getDate(job.at("end")), 1).front();
+            shard = &full;
+            storeDirectory = job.value("store", "");
+        }
+
+        u64 count;
+        if (type == "id5")
+        {
+            IDGenerator5 generator(parameters.value("initialAdvances", 0), parameters.value("maxAdvances", 0), parameters.value("pid", 0),
+                                   parameters.value("checkPID", false), parameters.value("checkXOR", false), profile, getIDFilter(filter));
+            if (searching)
+            {
+                IDSearcher5 searcher(generator, profile);
+                ResultWriter<SearcherState5<IDState>> writer(stream, format, seekable);
+                if (storeDirectory.empty())
+                {
+                    search<IDState>(searcher, threads, *shard, nullptr, writer);
+                }
+                else
+                {
+                    SearchStore5 store(storeDirectory, getFingerprint(job, profile), sizeof(SearcherState5<IDState>));
+                    search<IDState>(searcher, threads, *shard, &store, writer);
+                }
+                writer.finish();
+                count = writer.getCount();
+            }
+            else
+            {
+                ResultWriter<IDState> writer(stream, format, seekable);
+                writer.write(generator.generate(getSeed(job.at("seed"))));
+                writer.finish();
+                count = writer.getCount();
+            }
+        }
+        else if (type == "static5")
+        {
+            const StaticTemplate5 *staticTemplate = getStaticTemplate(parameters);
+            u32 initialAdvances = parameters.value("initialAdvances", 0);
+            u32 maxAdvances = parameters.value("maxAdvances", 0);
+            auto lead = static_cast<Lead>(parameters.value("lead", static_cast<int>(Lead::None)));
+            u8 luckyPower = parameters.value("luckyPower", 0);
+
+            if (searching)
+            {
+                StaticGenerator5 generator(initialAdvances, maxAdvances, 0, Method::Method5, lead, luckyPower, *staticTemplate, profile,
+                                           getStateFilter(filter));
+                IVSearcher5<StaticGenerator5, State5> searcher(parameters.value("initialIVAdvances", 0),
+                                                               parameters.value("maxIVAdvances", 0), generator, profile);
+                ResultWriter<SearcherState5<State5>> writer(stream, format, seekable);
+                if (storeDirectory.empty())
+                {
+                    search<State5>(searcher, threads, *shard, nullptr, writer);
+                }
+                else
+                {
+                    SearchStore5 store(storeDirectory, getFingerprint(job, profile), sizeof(SearcherState5<State5>));
+                    search<State5>(searcher, threads, *shard, &store, writer);
+                }
+                writer.finish();
+                count = writer.getCount();
+            }
+            else
+            {
+                StaticGenerator5 generator(initialAdvances, maxAdvances, parameters.value("offset", 0), Method::None, lead, luckyPower,
+                                           *staticTemplate, profile, getStateFilter(filter));
+                ResultWriter<State5> writer(stream, format, seekable);
+                writer.write(generator.generate(getSeed(job.at("seed")), parameters.value("ivAdvances", 0), 0));
+                writer.finish();
+                count = writer.getCount();
+            }
+        }
+        else if (type == "seedtime5")
+        {
+            std::string path = job.at("table").get<std::string>();
+            Date start = getDate(job.at("start"));
+            Date end = getDate(job.at("end"));
+
+            // The table is only built again when it does not cover the dates of the job
+            {
+                SeedTable table(path);
+                if (!table.isValid(profile) || table.getStartDate() > start || table.getEndDate() < end)
+                {
+                    buildSeedTable(path, profile, start, end, threads);
+                }
+            }
+
+            SeedTable table(path);
+            if (!table.isValid(profile))
+            {
+                throw std::runtime_error("Unable to read " + path);
+            }
+
+            std::vector<u64> seeds;
+            if (job.contains("seed"))
+            {
+                seeds.emplace_back(getSeed(job.at("seed")));
+            }
+            for (const auto &seed : job.value("seeds", json::array()))
+            {
+                seeds.emplace_back(getSeed(seed));
+            }
+
+            ResultWriter<SeedTime5> writer(stream, format, seekable);
+            for (u64 seed : seeds)
+            {
+                std::vector<SeedTime5> results = table.find(seed);
+                std::erase_if(results, [&start, &end](const SeedTime5 &result) {
+                    Date date = result.getDateTime().getDate();
+                    return date < start || date > end;
+                });
+                writer.write(results);
+            }
+            writer.finish();
+            count = writer.getCount();
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown job type: " + type);
+        }
+
+        reportProgress(100, count);
+    }
+
+    SearchManifest5 split(const json &job, u32 count)
+    {
+        Profile5 profile = ProfileLoader5::fromJson(job.at("profile").dump());
+        return { profile, job.dump(), SearchShards5::split(profile, getDate(job.at("start")), getDate(job.at("end")), count) };
+    }
+}
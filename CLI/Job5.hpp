@@ -0,0 +1,85 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef JOB5_HPP
+#define JOB5_HPP
+
+#include "ResultWriter.hpp"
+#include <Core/Gen5/Searchers/SearchShard5.hpp>
+#include <nlohmann/json.hpp>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Runs Gen 5 jobs described in JSON. Invalid jobs throw std::invalid_argument or nlohmann::json::exception.
+ *
+ * A job has the following fields:
+ * type: "id5", "static5", or "seedtime5"
+ * mode: "search" (default) or "generate", ignored by "seedtime5"
+ * profile: Profile in the same format as the profiles file
+ * threads: Number of search threads (defaults to all cores)
+ * start, end: Search dates as "YYYY-MM-DD"
+ * seed: Generator seed as a number or hex string. For "seedtime5" the initial seed to find the date/time of.
+ * seeds: More initial seeds to find for "seedtime5"
+ * table: Path of the seed table used by "seedtime5". The table is built first if it does not cover the dates of the job.
+ * parameters: Generator and searcher parameters
+ * filter: Result filter
+ * format: "csv" (default), "jsonl", or "binary"
+ * output: Output path (defaults to stdout)
+ * store: Directory of a result store. Searches with the same settings reuse the stored results, so only dates and Timer0 values that
+ *        were not searched before are searched. Ignored when running a shard.
+ */
+namespace Job5
+{
+    /**
+     * @brief Combines the shard result files of a sharded job into one sorted binary result file
+     *
+     * @param manifest Search manifest
+     * @param inputs Paths of the shard result files
+     * @param output Path of the merged result file
+     *
+     * @return true Results were merged
+     * @return false A result file could not be read or written
+     */
+    bool merge(const SearchManifest5 &manifest, const std::vector<std::string> &inputs, const std::string &output);
+
+    /**
+     * @brief Runs the \p job and writes its results as they are found. Progress is reported on stderr as JSON lines.
+     *
+     * @param job Job description
+     * @param shard Shard of the search to run, or nullptr to search the date range of the job
+     * @param stream Output stream
+     * @param format Output format
+     * @param seekable Whether \p stream can be rewound
+     */
+    void run(const nlohmann::json &job, const SearchShard5 *shard, std::ostream &stream, OutputFormat format, bool seekable);
+
+    /**
+     * @brief Splits the search of the \p job into shards
+     *
+     * @param job Job description
+     * @param count Requested number of shards
+     *
+     * @return Search manifest
+     */
+    SearchManifest5 split(const nlohmann::json &job, u32 count);
+}
+
+#endif // JOB5_HPP
@@ -0,0 +1,76 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "ResultWriter.hpp"
+#include <Core/Gen5/SeedTable.hpp>
+#include <Core/Gen5/States/State5.hpp>
+#include <Core/Parents/States/IDState.hpp>
+#include <cstdio>
+
+namespace ResultFields
+{
+    nlohmann::ordered_json getFields(const IDState &state)
+    {
+        nlohmann::ordered_json j;
+        j["advances"] = state.getAdvances();
+        j["tid"] = state.getTID();
+        j["sid"] = state.getSID();
+        j["tsv"] = state.getTSV();
+        return j;
+    }
+
+    nlohmann::ordered_json getFields(const State5 &state)
+    {
+        char pid[9];
+        std::snprintf(pid, sizeof(pid), "%08x", state.getPID());
+
+        nlohmann::ordered_json j;
+        j["ivAdvances"] = state.getIVAdvances();
+        j["advances"] = state.getAdvances();
+        j["needle"] = state.getNeedle();
+        j["pid"] = pid;
+        j["shiny"] = state.getShiny();
+        j["nature"] = state.getNature();
+        j["ability"] = state.getAbility();
+        j["gender"] = state.getGender();
+        j["level"] = state.getLevel();
+        j["hp"] = state.getIV(0);
+        j["atk"] = state.getIV(1);
+        j["def"] = state.getIV(2);
+        j["spa"] = state.getIV(3);
+        j["spd"] = state.getIV(4);
+        j["spe"] = state.getIV(5);
+        j["hiddenPower"] = state.getHiddenPower();
+        j["hiddenPowerStrength"] = state.getHiddenPowerStrength();
+        return j;
+    }
+
+    nlohmann::ordered_json getFields(const SeedTime5 &result)
+    {
+        char seed[17];
+        std::snprintf(seed, sizeof(seed), "%016llx", static_cast<unsigned long long>(result.getInitialSeed()));
+
+        nlohmann::ordered_json j;
+        j["seed"] = seed;
+        j["dateTime"] = result.getDateTime().toString();
+        j["timer0"] = result.getTimer0();
+        j["buttons"] = static_cast<u16>(result.getButtons());
+        return j;
+    }
+}
@@ -0,0 +1,223 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RESULTWRITER_HPP
+#define RESULTWRITER_HPP
+
+#include <Core/Gen5/Searchers/SearchShard5.hpp>
+#include <Core/Gen5/States/SearcherState5.hpp>
+#include <Core/Global.hpp>
+#include <cstdio>
+#include <nlohmann/json.hpp>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+class IDState;
+class SeedTime5;
+class State5;
+
+/**
+ * @brief Formats that results can be written in
+ */
+enum class OutputFormat : u8
+{
+    CSV,
+    JSONLines,
+    Binary
+};
+
+namespace ResultFields
+{
+    /**
+     * @brief Gets the fields of an ID result
+     *
+     * @param state ID state
+     *
+     * @return Ordered fields of the result
+     */
+    nlohmann::ordered_json getFields(const IDState &state);
+
+    /**
+     * @brief Gets the fields of a Gen 5 result
+     *
+     * @param state Pokemon state
+     *
+     * @return Ordered fields of the result
+     */
+    nlohmann::ordered_json getFields(const State5 &state);
+
+    /**
+     * @brief Gets the fields of a Gen 5 seed to date/time result
+     *
+     * @param result Seed to date/time result
+     *
+     * @return Ordered fields of the result
+     */
+    nlohmann::ordered_json getFields(const SeedTime5 &result);
+
+    /**
+     * @brief Gets the fields of a Gen 5 search result followed by the fields of its state
+     *
+     * @tparam State State class of the searcher
+     * @param result Search result
+     *
+     * @return Ordered fields of the result
+     */
+    template <class State>
+    nlohmann::ordered_json getFields(const SearcherState5<State> &result)
+    {
+        char seed[17];
+        std::snprintf(seed, sizeof(seed), "%016llx", static_cast<unsigned long long>(result.getInitialSeed()));
+
+        nlohmann::ordered_json j;
+        j["seed"] = seed;
+        j["dateTime"] = result.getDateTime().toString();
+        j["timer0"] = result.getTimer0();
+        j["buttons"] = static_cast<u16>(result.getButtons());
+        j.update(getFields(result.getState()));
+        return j;
+    }
+}
+
+/**
+ * @brief Writes results to a stream as they arrive
+ *
+ * @tparam Result Result class
+ */
+template <class Result>
+class ResultWriter
+{
+public:
+    /**
+     * @brief Construct a new ResultWriter object
+     *
+     * @param stream Output stream
+     * @param format Output format
+     * @param seekable Whether the stream can be rewound to store the final result count of the binary format
+     */
+    ResultWriter(std::ostream &stream, OutputFormat format, bool seekable) : stream(stream), count(0), format(format), seekable(seekable)
+    {
+        static_assert(std::is_trivially_copyable_v<Result>, "Results must be trivially copyable");
+
+        if (format == OutputFormat::Binary)
+        {
+            SearchShards5::writeResultHeader(stream, sizeof(Result), SearchShards5::unknownCount);
+        }
+    }
+
+    /**
+     * @brief Finishes writing. The binary format stores the final result count if the stream is seekable.
+     */
+    void finish()
+    {
+        if (format == OutputFormat::Binary && seekable)
+        {
+            auto end = stream.tellp();
+            stream.seekp(0);
+            SearchShards5::writeResultHeader(stream, sizeof(Result), count);
+            stream.seekp(end);
+        }
+        stream.flush();
+    }
+
+    /**
+     * @brief Returns the number of written results
+     *
+     * @return Result count
+     */
+    u64 getCount() const
+    {
+        return count;
+    }
+
+    /**
+     * @brief Writes the \p results
+     *
+     * @param results Results to write
+     */
+    void write(const std::vector<Result> &results)
+    {
+        for (const auto &result : results)
+        {
+            if (format == OutputFormat::Binary)
+            {
+                stream.write(reinterpret_cast<const char *>(&result), sizeof(Result));
+            }
+            else
+            {
+                auto fields = ResultFields::getFields(result);
+                if (format == OutputFormat::JSONLines)
+                {
+                    stream << fields.dump() << '\n';
+                }
+                else
+                {
+                    if (count == 0)
+                    {
+                        writeCSV(fields, true);
+                    }
+                    writeCSV(fields, false);
+                }
+            }
+            count++;
+        }
+    }
+
+private:
+    std::ostream &stream;
+    u64 count;
+    OutputFormat format;
+    bool seekable;
+
+    /**
+     * @brief Writes one CSV line with either the names or the values of the \p fields
+     *
+     * @param fields Ordered fields of a result
+     * @param header Whether to write the field names
+     */
+    void writeCSV(const nlohmann::ordered_json &fields, bool header)
+    {
+        bool first = true;
+        for (const auto &[key, value] : fields.items())
+        {
+            if (!first)
+            {
+                stream << ',';
+            }
+            first = false;
+
+            if (header)
+            {
+                stream << key;
+            }
+            else if (value.is_string())
+            {
+                stream << value.template get<std::string>();
+            }
+            else
+            {
+                stream << value.dump();
+            }
+        }
+        stream << '\n';
+    }
+};
+
+#endif // RESULTWRITER_HPP
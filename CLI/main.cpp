@@ -0,0 +1,235 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Job5.hpp"
+#include <Core/Gen5/Searchers/SearchShard5.hpp>
+#include <Core/Parents/ProfileLoader.hpp>
+#include <fstream>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+using json = nlohmann::json;
+
+/**
+ * @brief Prints how to use the program
+ */
+static void printUsage()
+{
+    std::cerr << "Usage:\n"
+                 "  PokeFinderCLI <job.json|-> [--format csv|jsonl|binary] [--output path] [--store directory]\n"
+                 "  PokeFinderCLI --split <job.json> <count> <manifest.json>\n"
+                 "  PokeFinderCLI --shard <manifest.json> <index> <results>\n"
+                 "  PokeFinderCLI --merge <manifest.json> <results> <shard results...>\n"
+                 "Job types: id5, static5, seedtime5\n";
+}
+
+/**
+ * @brief Writes an error to stderr as a JSON line
+ *
+ * @param message Error message
+ */
+static void reportError(const std::string &message)
+{
+    json j;
+    j["error"] = message;
+    std::cerr << j.dump() << std::endl;
+}
+
+/**
+ * @brief Reads a job from a file, or from stdin if \p path is "-"
+ *
+ * @param path Path of the job file
+ *
+ * @return Job description
+ */
+static json readJob(const std::string &path)
+{
+    if (path == "-")
+    {
+        return json::parse(std::cin);
+    }
+
+    std::ifstream read(path);
+    if (!read.is_open())
+    {
+        throw std::invalid_argument("Unable to open " + path);
+    }
+    return json::parse(read);
+}
+
+/**
+ * @brief Reads the output format name
+ *
+ * @param name Format name
+ *
+ * @return Output format
+ */
+static OutputFormat getFormat(const std::string &name)
+{
+    if (name == "csv")
+    {
+        return OutputFormat::CSV;
+    }
+    else if (name == "jsonl")
+    {
+        return OutputFormat::JSONLines;
+    }
+    else if (name == "binary")
+    {
+        return OutputFormat::Binary;
+    }
+    throw std::invalid_argument("Unknown format: " + name);
+}
+
+/**
+ * @brief Reads a search manifest
+ *
+ * @param path Path of the manifest file
+ *
+ * @return Search manifest
+ */
+static SearchManifest5 readManifest(const std::string &path)
+{
+    auto manifest = SearchShards5::readManifest(path);
+    if (!manifest)
+    {
+        throw std::invalid_argument("Invalid manifest " + path);
+    }
+    return *manifest;
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> args(argv + 1, argv + argc);
+    if (args.empty())
+    {
+        printUsage();
+        return 1;
+    }
+
+    try
+    {
+        if (args[0] == "--split" && args.size() == 4)
+        {
+            SearchManifest5 manifest = Job5::split(readJob(args[1]), std::stoul(args[2]));
+            if (!SearchShards5::writeManifest(args[3], manifest))
+            {
+                throw std::invalid_argument("Unable to write " + args[3]);
+            }
+            std::cout << manifest.shards.size() << std::endl;
+        }
+        else if (args[0] == "--shard" && args.size() == 4)
+        {
+            SearchManifest5 manifest = readManifest(args[1]);
+            u32 index = std::stoul(args[2]);
+            if (index >= manifest.shards.size())
+            {
+                throw std::invalid_argument("Invalid shard index");
+            }
+
+            // Shards always use the profile of the manifest so every shard searches the same profile
+            json job = json::parse(manifest.job);
+            job["profile"] = json::parse(ProfileLoader5::toJson(manifest.profile));
+
+            std::ofstream write(args[3], std::ios::binary | std::ios::trunc);
+            if (!write.is_open())
+            {
+                throw std::invalid_argument("Unable to write " + args[3]);
+            }
+            Job5::run(job, &manifest.shards[index], write, OutputFormat::Binary, true);
+        }
+        else if (args[0] == "--merge" && args.size() >= 4)
+        {
+            SearchManifest5 manifest = readManifest(args[1]);
+            if (!Job5::merge(manifest, std::vector<std::string>(args.begin() + 3, args.end()), args[2]))
+            {
+                throw std::invalid_argument("Unable to merge results");
+            }
+        }
+        else if (args[0].starts_with("--"))
+        {
+            printUsage();
+            return 1;
+        }
+        else
+        {
+            json job = readJob(args[0]);
+            OutputFormat format = getFormat(job.value("format", "csv"));
+            std::string output = job.value("output", "");
+            for (size_t i = 1; i < args.size(); i += 2)
+            {
+                if (i + 1 == args.size())
+                {
+                    // Every option takes a value
+                    printUsage();
+                    return 1;
+                }
+                else if (args[i] == "--format")
+                {
+                    format = getFormat(args[i + 1]);
+                }
+                else if (args[i] == "--output")
+                {
+                    output = args[i + 1];
+                }
+                else if (args[i] == "--store")
+                {
+                    job["store"] = args[i + 1];
+                }
+                else
+                {
+                    printUsage();
+                    return 1;
+                }
+            }
+
+            if (output.empty() || output == "-")
+            {
+#ifdef _WIN32
+                _setmode(_fileno(stdout), _O_BINARY);
+#endif
+                Job5::run(job, nullptr, std::cout, format, false);
+            }
+            else
+            {
+                std::ofstream write(output, std::ios::binary | std::ios::trunc);
+                if (!write.is_open())
+                {
+                    throw std::invalid_argument("Unable to write " + output);
+                }
+                Job5::run(job, nullptr, write, format, true);
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        reportError(e.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -32,41 +32,17 @@ StaticSearcher3::StaticSearcher3(Method method, const Profile3 &profile, const S
 {
 }
 
-void StaticSearcher3::startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max, const StaticTemplate3 *staticTemplate)
+void StaticSearcher3::startSearch(int threads, const std::array<u8, 6> &min, const std::array<u8, 6> &max,
+                                  const StaticTemplate3 *staticTemplate)
 {
     searching = true;
 
-    for (u8 hp = min[0]; hp <= max[0]; hp++)
-    {
-        for (u8 atk = min[1]; atk <= max[1]; atk++)
-        {
-            for (u8 def = min[2]; def <= max[2]; def++)
-            {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
-                {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            auto states = search(hp, atk, def, spa, spd, spe, staticTemplate);
-
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
-                }
-            }
-        }
-    }
+    searchIVs(threads, min, max, method, [this, staticTemplate](const std::array<u8, 6> &ivs, const RecoverySeeds<6> &seeds) {
+        return search(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], seeds, staticTemplate);
+    });
 }
 
-std::vector<SearcherState> StaticSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState> StaticSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
                                                    const StaticTemplate3 *staticTemplate) const
 {
     std::vector<SearcherState> states;
@@ -81,7 +57,6 @@ std::vector<SearcherState> StaticSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa
     }
     const PersonalInfo *info = staticTemplate->getInfo();
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, method);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
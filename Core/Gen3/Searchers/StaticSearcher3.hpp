@@ -42,13 +42,14 @@ public:
     StaticSearcher3(Method method, const Profile3 &profile, const StateFilter &filter);
 
     /**
-     * @brief Starts the search
+     * @brief Starts the search. The IV range is split between \p threads threads.
      *
+     * @param threads Number of threads to search with
      * @param min Minimum IVs
      * @param max Maximum IVs
      * @param staticTemplate Pokemon template
      */
-    void startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max, const StaticTemplate3 *staticTemplate);
+    void startSearch(int threads, const std::array<u8, 6> &min, const std::array<u8, 6> &max, const StaticTemplate3 *staticTemplate);
 
 private:
     bool ivAdvance;
@@ -62,11 +63,13 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate3 *staticTemplate) const;
+    std::vector<SearcherState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                      const StaticTemplate3 *staticTemplate) const;
 };
 
 #endif // STATICSEARCHER3_HPP
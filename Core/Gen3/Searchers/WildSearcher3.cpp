@@ -90,7 +90,7 @@ WildSearcher3::WildSearcher3(Method method, Lead lead, bool feebasTile, bool bik
     }
 }
 
-void WildSearcher3::startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max)
+void WildSearcher3::startSearch(int threads, const std::array<u8, 6> &min, const std::array<u8, 6> &max)
 {
     searching = true;
 
@@ -100,43 +100,18 @@ void WildSearcher3::startSearch(const std::array<u8, 6> &min, const std::array<u
     bool safari = area.safariZone(profile.getVersion());
     bool tanoby = area.tanobyChamber(profile.getVersion());
 
-    for (u8 hp = min[0]; hp <= max[0]; hp++)
-    {
-        for (u8 atk = min[1]; atk <= max[1]; atk++)
-        {
-            for (u8 def = min[2]; def <= max[2]; def++)
-            {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
-                {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            auto states = search(hp, atk, def, spa, spd, spe, feebas, safari, tanoby);
-
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
-                }
-            }
-        }
-    }
+    searchIVs(threads, min, max, method, [this, feebas, safari, tanoby](const std::array<u8, 6> &ivs, const RecoverySeeds<6> &seeds) {
+        return search(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], seeds, feebas, safari, tanoby);
+    });
 }
 
-std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, bool feebas, bool safari,
+std::vector<WildSearcherState> WildSearcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                     bool feebas, bool safari,
                                                      bool tanoby) const
 {
     std::vector<WildSearcherState> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, method);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
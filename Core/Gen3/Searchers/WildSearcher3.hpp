@@ -50,12 +50,13 @@ public:
                   const Profile3 &profile, const WildStateFilter &filter);
 
     /**
-     * @brief Starts the search
+     * @brief Starts the search. The IV range is split between \p threads threads.
      *
+     * @param threads Number of threads to search with
      * @param min Minimum IVs
      * @param max Maximum IVs
      */
-    void startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max);
+    void startSearch(int threads, const std::array<u8, 6> &min, const std::array<u8, 6> &max);
 
 private:
     u16 rate;
@@ -74,13 +75,15 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param feebas Whether the encounter location contains Feebas
      * @param safari Whether the encounter location is the Safari Zone in RSE
      * @param tanoby Whether the encounter location is Tanoby Ruins in FRLG
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, bool feebas, bool safari, bool tanoby) const;
+    std::vector<WildSearcherState> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds, bool feebas,
+                                          bool safari, bool tanoby) const;
 };
 
 #endif // WILDSEARCHER3_HPP
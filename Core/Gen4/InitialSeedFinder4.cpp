@@ -0,0 +1,324 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "InitialSeedFinder4.hpp"
+#include <Core/RNG/LCRNG.hpp>
+#include <Core/RNG/SIMD.hpp>
+#include <algorithm>
+
+/**
+ * @brief Computes the number of advances from 0 to the initial seed of each entry, with one entry per lane of \p Vector.
+ * This is LCRNG::distance without the early exit, so every lane takes the same jumps.
+ *
+ * @tparam Vector SIMD vector type
+ * @param entries Pairs of position and initial seed, positions are filled in
+ */
+template <class Vector>
+static void computeDistances(std::vector<std::pair<u32, u32>> &entries)
+{
+    constexpr u32 lanes = sizeof(Vector) / sizeof(u32);
+    constexpr JumpTable table = computeJumpTable(PokeRNG::getAdd(), PokeRNG::getMult());
+
+    for (size_t i = 0; i < entries.size(); i += lanes)
+    {
+        u32 count = static_cast<u32>(std::min<size_t>(lanes, entries.size() - i));
+
+        Vector end(0);
+        for (u32 lane = 0; lane < count; lane++)
+        {
+            end.uint32[lane] = entries[i + lane].second;
+        }
+
+        Vector start(0);
+        Vector distance(0);
+        for (int bit = 0; bit < 32; bit++)
+        {
+            Vector p(1u << bit);
+            Vector mask = ((start ^ end) & p) == p;
+            Vector jump = start * Vector(table.jump[bit].mult) + Vector(table.jump[bit].add);
+
+            start = (jump & mask) | (start & ~mask);
+            distance = distance | (p & mask);
+        }
+
+        for (u32 lane = 0; lane < count; lane++)
+        {
+            entries[i + lane].first = distance.uint32[lane];
+        }
+    }
+}
+
+/**
+ * @brief Searches backwards from \p seed with the advance range split into contiguous segments over the lanes of \p Vector.
+ * Several vectors are walked at once to hide the latency of the multiplication. States and matches are buffered per block of
+ * advances and only the lanes that matched in a block are scanned to recover the advances.
+ *
+ * @tparam Vector SIMD vector type
+ * @param seed PRNG state to reach
+ * @param minAdvance Minimum advances
+ * @param maxAdvance Maximum advances
+ * @param minDelay Minimum delay
+ * @param maxDelay Maximum delay
+ * @param seeds Matching initial seeds and their advances
+ */
+template <class Vector>
+static void searchLanes(u32 seed, u32 minAdvance, u32 maxAdvance, u16 minDelay, u16 maxDelay, std::vector<std::pair<u32, u32>> &seeds)
+{
+    constexpr u32 lanes = sizeof(Vector) / sizeof(u32);
+    constexpr u32 ways = 4;
+    constexpr u32 block = 16;
+
+    u32 segment = (maxAdvance - minAdvance) / (lanes * ways) + 1;
+    size_t size = seeds.size();
+
+    Vector state[ways];
+    for (u32 way = 0; way < ways; way++)
+    {
+        for (u32 lane = 0; lane < lanes; lane++)
+        {
+            state[way].uint32[lane] = PokeRNGR(seed, minAdvance + (way * lanes + lane) * segment).getSeed();
+        }
+    }
+
+    Vector mult(0xeeb9eb65);
+    Vector add(0xa3561a1);
+    Vector hourMask(0xff);
+    Vector delayMask(0xffff);
+    Vector zero(0);
+
+    // Carry and sign bits flag hour >= 24, delay < minDelay and delay > maxDelay
+    Vector hourBias(256 - 24);
+    Vector minBias(0 - static_cast<u32>(minDelay));
+    Vector maxBias(static_cast<u32>(maxDelay) + 1);
+
+    for (u32 offset = 0; offset < segment; offset += block)
+    {
+        u32 steps = std::min(block, segment - offset);
+
+        Vector states[block][ways];
+        Vector matches[block][ways];
+        Vector hit[ways];
+        for (u32 way = 0; way < ways; way++)
+        {
+            hit[way] = zero;
+        }
+
+        for (u32 i = 0; i < steps; i++)
+        {
+            for (u32 way = 0; way < ways; way++)
+            {
+                Vector delay = state[way] & delayMask;
+                Vector fail = ((((state[way] >> 16) & hourMask) + hourBias) >> 8) | (((delay + minBias) | (~delay + maxBias)) >> 31);
+                Vector match = fail == zero;
+
+                states[i][way] = state[way];
+                matches[i][way] = match;
+                hit[way] = hit[way] | match;
+                state[way] = state[way] * mult + add;
+            }
+        }
+
+        for (u32 way = 0; way < ways; way++)
+        {
+            for (u32 lane = 0; lane < lanes; lane++)
+            {
+                if (hit[way].uint32[lane])
+                {
+                    u32 cnt = minAdvance + (way * lanes + lane) * segment + offset;
+                    for (u32 i = 0; i < steps && cnt <= maxAdvance; i++, cnt++)
+                    {
+                        if (matches[i][way].uint32[lane])
+                        {
+                            seeds.emplace_back(states[i][way].uint32[lane], cnt);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Blocks are visited in lockstep across the segments, restore the order of advances with a stable counting sort by segment
+    u32 offsets[lanes * ways + 1] = {};
+    for (size_t i = size; i < seeds.size(); i++)
+    {
+        offsets[(seeds[i].second - minAdvance) / segment + 1]++;
+    }
+
+    for (u32 i = 1; i <= lanes * ways; i++)
+    {
+        offsets[i] += offsets[i - 1];
+    }
+
+    std::vector<std::pair<u32, u32>> sorted(seeds.size() - size);
+    for (size_t i = size; i < seeds.size(); i++)
+    {
+        sorted[offsets[(seeds[i].second - minAdvance) / segment]++] = seeds[i];
+    }
+    std::copy(sorted.begin(), sorted.end(), seeds.begin() + size);
+}
+
+InitialSeedFinder4::InitialSeedFinder4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u32 maxDelay) :
+    maxAdvance(maxAdvance),
+    minAdvance(minAdvance),
+    maxDelay(std::min(maxDelay, 0xffffu)),
+    minDelay(std::min(minDelay, 0xffffu)),
+    table(false),
+    valid(minAdvance <= maxAdvance && minDelay <= maxDelay && minDelay <= 0xffff)
+{
+    if (valid)
+    {
+        // Placing an initial seed costs about as much as walking 150 advances, but it is only paid once while the walk is paid for
+        // every searched seed. The table is capped at 16M initial seeds (128MB).
+        u64 candidates = 256 * 24 * static_cast<u64>(this->maxDelay - this->minDelay + 1);
+        u64 range = static_cast<u64>(maxAdvance - minAdvance) + 1;
+        table = candidates <= 0x1000000 && candidates * 16 <= range;
+    }
+}
+
+void InitialSeedFinder4::search(u32 seed, std::vector<std::pair<u32, u32>> &seeds) const
+{
+    if (!valid)
+    {
+        return;
+    }
+
+    if (table)
+    {
+        searchTable(seed, seeds);
+    }
+    else
+    {
+        searchWalk(seed, seeds);
+    }
+}
+
+void InitialSeedFinder4::computeEntries() const
+{
+    entries.reserve(256 * 24 * (maxDelay - minDelay + 1));
+    for (u32 ab = 0; ab < 256; ab++)
+    {
+        for (u32 cd = 0; cd < 24; cd++)
+        {
+            for (u32 efgh = minDelay; efgh <= maxDelay; efgh++)
+            {
+                entries.emplace_back(0, (ab << 24) | (cd << 16) | efgh);
+            }
+        }
+    }
+
+#ifdef SIMD_X86
+    if (hasAVX2())
+    {
+        computeDistances<vuint256>(entries);
+    }
+    else
+#endif
+    {
+        computeDistances<vuint128>(entries);
+    }
+
+    // Radix sort the positions, 16bits at a time
+    std::vector<std::pair<u32, u32>> buffer(entries.size());
+    for (int shift = 0; shift < 32; shift += 16)
+    {
+        std::vector<u32> offsets(0x10001, 0);
+        for (const auto &entry : entries)
+        {
+            offsets[((entry.first >> shift) & 0xffff) + 1]++;
+        }
+
+        for (u32 i = 1; i < 0x10000; i++)
+        {
+            offsets[i] += offsets[i - 1];
+        }
+
+        for (const auto &entry : entries)
+        {
+            buffer[offsets[(entry.first >> shift) & 0xffff]++] = entry;
+        }
+        entries.swap(buffer);
+    }
+}
+
+void InitialSeedFinder4::searchTable(u32 seed, std::vector<std::pair<u32, u32>> &seeds) const
+{
+    std::call_once(once, [this] { computeEntries(); });
+
+    // Advances from an initial seed are the difference of the positions on the PRNG cycle.
+    // The closest initial seeds come first, which are the highest positions before the seed.
+    u32 position = PokeRNG::distance(0, seed);
+    auto searchRange = [&](u32 low, u32 high) {
+        auto first
+            = std::lower_bound(entries.begin(), entries.end(), low, [](const auto &entry, u32 value) { return entry.first < value; });
+        auto last = std::upper_bound(first, entries.end(), high, [](u32 value, const auto &entry) { return value < entry.first; });
+        while (last != first)
+        {
+            --last;
+            seeds.emplace_back(last->second, position - last->first);
+        }
+    };
+
+    u32 low = position - maxAdvance;
+    u32 high = position - minAdvance;
+    if (low <= high)
+    {
+        searchRange(low, high);
+    }
+    else
+    {
+        // Range wraps around the start of the PRNG cycle
+        searchRange(0, high);
+        searchRange(low, 0xffffffff);
+    }
+}
+
+void InitialSeedFinder4::searchWalk(u32 seed, std::vector<std::pair<u32, u32>> &seeds) const
+{
+    // Short ranges are not worth the setup of the lanes
+    if (maxAdvance - minAdvance < 2048)
+    {
+        PokeRNGR rng(seed, minAdvance);
+        seed = rng.getSeed();
+        for (u32 cnt = minAdvance; cnt <= maxAdvance; cnt++)
+        {
+            u8 hour = (seed >> 16) & 0xFF;
+            u16 delay = seed & 0xFFFF;
+
+            // Check if seed matches a valid gen 4 format
+            if (hour < 24 && delay >= minDelay && delay <= maxDelay)
+            {
+                seeds.emplace_back(seed, cnt);
+            }
+
+            seed = rng.next();
+        }
+        return;
+    }
+
+#ifdef SIMD_X86
+    if (hasAVX2())
+    {
+        searchLanes<vuint256>(seed, minAdvance, maxAdvance, minDelay, maxDelay, seeds);
+    }
+    else
+#endif
+    {
+        searchLanes<vuint128>(seed, minAdvance, maxAdvance, minDelay, maxDelay, seeds);
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef INITIALSEEDFINDER4_HPP
+#define INITIALSEEDFINDER4_HPP
+
+#include <Core/Global.hpp>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Finds the Gen 4 initial seeds that reach a seed within an advance range.
+ * Short advance ranges are walked backwards from the seed. When the range is much larger than the number of valid initial seeds,
+ * the valid initial seeds are instead placed on the PRNG cycle once and each seed is matched against them with a range lookup.
+ */
+class InitialSeedFinder4
+{
+public:
+    /**
+     * @brief Construct a new InitialSeedFinder4 object
+     *
+     * @param minAdvance Minimum advances
+     * @param maxAdvance Maximum advances
+     * @param minDelay Minimum delay
+     * @param maxDelay Maximum delay
+     */
+    InitialSeedFinder4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u32 maxDelay);
+
+    /**
+     * @brief Searches for initial seeds that match a valid gen 4 format and reach \p seed within the advance range
+     *
+     * @param seed PRNG state to reach
+     * @param seeds Matching initial seeds and their advances, in ascending order of advances
+     */
+    void search(u32 seed, std::vector<std::pair<u32, u32>> &seeds) const;
+
+private:
+    mutable std::once_flag once;
+    mutable std::vector<std::pair<u32, u32>> entries;
+    u32 maxAdvance;
+    u32 minAdvance;
+    u16 maxDelay;
+    u16 minDelay;
+    bool table;
+    bool valid;
+
+    /**
+     * @brief Computes the position of every valid initial seed on the PRNG cycle, sorted by position
+     */
+    void computeEntries() const;
+
+    /**
+     * @brief Searches backwards from \p seed one advance at a time. The advance range is split between SIMD lanes that are
+     * reversed together.
+     *
+     * @param seed PRNG state to reach
+     * @param seeds Matching initial seeds and their advances, in ascending order of advances
+     */
+    void searchWalk(u32 seed, std::vector<std::pair<u32, u32>> &seeds) const;
+
+    /**
+     * @brief Searches the positions of the valid initial seeds that are within the advance range behind \p seed
+     *
+     * @param seed PRNG state to reach
+     * @param seeds Matching initial seeds and their advances, in ascending order of advances
+     */
+    void searchTable(u32 seed, std::vector<std::pair<u32, u32>> &seeds) const;
+};
+
+#endif // INITIALSEEDFINDER4_HPP
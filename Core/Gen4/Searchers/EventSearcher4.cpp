@@ -27,7 +27,7 @@
 
 EventSearcher4::EventSearcher4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u32 maxDelay, const Profile4 &profile,
                                const StateFilter &filter) :
-    Searcher(Method::None, profile), maxAdvance(maxAdvance), minAdvance(minAdvance), maxDelay(maxDelay), minDelay(minDelay), filter(filter)
+    Searcher(Method::None, profile), initialSeeds(minAdvance, maxAdvance, minDelay, maxDelay), filter(filter)
 {
 }
 
@@ -95,24 +95,16 @@ std::vector<SearcherState4> EventSearcher4::searchInitialSeeds(const std::vector
 {
     std::vector<SearcherState4> states;
 
+    std::vector<std::pair<u32, u32>> seeds;
     for (SearcherState4 result : results)
     {
-        PokeRNGR rng(result.getSeed(), minAdvance);
-        u32 seed = rng.getSeed();
-        for (u32 cnt = minAdvance; cnt <= maxAdvance; cnt++)
+        seeds.clear();
+        initialSeeds.search(result.getSeed(), seeds);
+        for (const auto &[seed, advances] : seeds)
         {
-            u8 hour = (seed >> 16) & 0xFF;
-            u16 delay = seed & 0xFFFF;
-
-            // Check if seed matches a valid gen 4 format
-            if (hour < 24 && delay >= minDelay && delay <= maxDelay)
-            {
-                result.setSeed(seed);
-                result.setAdvances(cnt);
-                states.emplace_back(result);
-            }
-
-            seed = rng.next();
+            result.setSeed(seed);
+            result.setAdvances(advances);
+            states.emplace_back(result);
         }
     }
 
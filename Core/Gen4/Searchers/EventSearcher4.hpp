@@ -20,6 +20,7 @@
 #ifndef EVENTSEARCHER4_HPP
 #define EVENTSEARCHER4_HPP
 
+#include <Core/Gen4/InitialSeedFinder4.hpp>
 #include <Core/Gen4/Profile4.hpp>
 #include <Core/Gen4/States/State4.hpp>
 #include <Core/Parents/Filters/StateFilter.hpp>
@@ -55,10 +56,7 @@ public:
     void startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max, u16 species, u8 nature, u8 level);
 
 private:
-    u32 maxAdvance;
-    u32 minAdvance;
-    u32 maxDelay;
-    u32 minDelay;
+    InitialSeedFinder4 initialSeeds;
     StateFilter filter;
 
     /**
@@ -30,15 +30,13 @@
 StaticSearcher4::StaticSearcher4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u32 maxDelay, Method method, Lead lead,
                                  const Profile4 &profile, const StateFilter &filter) :
     StaticSearcher(method, lead, profile, filter),
-    maxAdvance(maxAdvance),
-    minAdvance(minAdvance),
-    maxDelay(maxDelay),
-    minDelay(minDelay),
+    initialSeeds(minAdvance, maxAdvance, minDelay, maxDelay),
     buffer(0)
 {
 }
 
-void StaticSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max, const StaticTemplate4 *staticTemplate)
+void StaticSearcher4::startSearch(int threads, const std::array<u8, 6> &min, const std::array<u8, 6> &max,
+                                  const StaticTemplate4 *staticTemplate)
 {
     searching = true;
 
@@ -54,52 +52,27 @@ void StaticSearcher4::startSearch(const std::array<u8, 6> &min, const std::array
         }
     }
 
-    for (u8 hp = min[0]; hp <= max[0]; hp++)
-    {
-        for (u8 atk = min[1]; atk <= max[1]; atk++)
-        {
-            for (u8 def = min[2]; def <= max[2]; def++)
-            {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
-                {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            auto states = search(hp, atk, def, spa, spd, spe, staticTemplate);
-
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
-                }
-            }
-        }
-    }
+    searchIVs(threads, min, max, Method::Method1, [this, staticTemplate](const std::array<u8, 6> &ivs, const RecoverySeeds<6> &seeds) {
+        return search(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], seeds, staticTemplate);
+    });
 }
 
-std::vector<SearcherState4> StaticSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState4> StaticSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
                                                     const StaticTemplate4 *staticTemplate) const
 {
     std::vector<SearcherState4> states;
 
     if (method == Method::Method1)
     {
-        states = searchMethod1(hp, atk, def, spa, spd, spe, staticTemplate);
+        states = searchMethod1(hp, atk, def, spa, spd, spe, seeds, staticTemplate);
     }
     else if (method == Method::MethodJ)
     {
-        states = searchMethodJ(hp, atk, def, spa, spd, spe, staticTemplate);
+        states = searchMethodJ(hp, atk, def, spa, spd, spe, seeds, staticTemplate);
     }
     else if (method == Method::MethodK)
     {
-        states = searchMethodK(hp, atk, def, spa, spd, spe, staticTemplate);
+        states = searchMethodK(hp, atk, def, spa, spd, spe, seeds, staticTemplate);
     }
 
     return searchInitialSeeds(states);
@@ -109,38 +82,29 @@ std::vector<SearcherState4> StaticSearcher4::searchInitialSeeds(const std::vecto
 {
     std::vector<SearcherState4> states;
 
+    std::vector<std::pair<u32, u32>> seeds;
     for (SearcherState4 result : results)
     {
-        PokeRNGR rng(result.getSeed(), minAdvance);
-        u32 seed = rng.getSeed();
-        for (u32 cnt = minAdvance; cnt <= maxAdvance; cnt++)
+        seeds.clear();
+        initialSeeds.search(result.getSeed(), seeds);
+        for (const auto &[seed, advances] : seeds)
         {
-            u8 hour = (seed >> 16) & 0xFF;
-            u16 delay = seed & 0xFFFF;
-
-            // Check if seed matches a valid gen 4 format
-            if (hour < 24 && delay >= minDelay && delay <= maxDelay)
-            {
-                result.setSeed(seed);
-                result.setAdvances(cnt);
-                states.emplace_back(result);
-            }
-
-            seed = rng.next();
+            result.setSeed(seed);
+            result.setAdvances(advances);
+            states.emplace_back(result);
         }
     }
 
     return states;
 }
 
-std::vector<SearcherState4> StaticSearcher4::searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState4> StaticSearcher4::searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
                                                            const StaticTemplate4 *staticTemplate) const
 {
     std::vector<SearcherState4> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
     const PersonalInfo *info = staticTemplate->getInfo();
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -191,14 +155,13 @@ std::vector<SearcherState4> StaticSearcher4::searchMethod1(u8 hp, u8 atk, u8 def
     return states;
 }
 
-std::vector<SearcherState4> StaticSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState4> StaticSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
                                                            const StaticTemplate4 *staticTemplate) const
 {
     std::vector<SearcherState4> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
     const PersonalInfo *info = staticTemplate->getInfo();
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -287,14 +250,13 @@ std::vector<SearcherState4> StaticSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def
     return states;
 }
 
-std::vector<SearcherState4> StaticSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+std::vector<SearcherState4> StaticSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
                                                            const StaticTemplate4 *staticTemplate) const
 {
     std::vector<SearcherState4> states;
     std::array<u8, 6> ivs = { hp, atk, def, spa, spd, spe };
     const PersonalInfo *info = staticTemplate->getInfo();
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -20,6 +20,7 @@
 #ifndef STATICSEARCHER4_HPP
 #define STATICSEARCHER4_HPP
 
+#include <Core/Gen4/InitialSeedFinder4.hpp>
 #include <Core/Gen4/Profile4.hpp>
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/Parents/Searchers/StaticSearcher.hpp>
@@ -49,19 +50,17 @@ public:
                     const StateFilter &filter);
 
     /**
-     * @brief Starts the search
+     * @brief Starts the search. The IV range is split between \p threads threads.
      *
+     * @param threads Number of threads to search with
      * @param min Minimum IVs
      * @param max Maximum IVs
      * @param staticTemplate Pokemon template
      */
-    void startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max, const StaticTemplate4 *staticTemplate);
+    void startSearch(int threads, const std::array<u8, 6> &min, const std::array<u8, 6> &max, const StaticTemplate4 *staticTemplate);
 
 private:
-    u32 maxAdvance;
-    u32 minAdvance;
-    u32 maxDelay;
-    u32 minDelay;
+    InitialSeedFinder4 initialSeeds;
     u8 buffer;
 
     /**
@@ -73,11 +72,13 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate4 *staticTemplate) const;
+    std::vector<SearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                       const StaticTemplate4 *staticTemplate) const;
 
     /**
      * @brief Searches for initial seeds within min/max advances and min/max delay
@@ -97,11 +98,13 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState4> searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate4 *staticTemplate) const;
+    std::vector<SearcherState4> searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                              const StaticTemplate4 *staticTemplate) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Method J
@@ -112,11 +115,13 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState4> searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate4 *staticTemplate) const;
+    std::vector<SearcherState4> searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                              const StaticTemplate4 *staticTemplate) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Method K
@@ -127,11 +132,13 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param staticTemplate Pokemon template
      *
      * @return Vector of computed states
      */
-    std::vector<SearcherState4> searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const StaticTemplate4 *staticTemplate) const;
+    std::vector<SearcherState4> searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                              const StaticTemplate4 *staticTemplate) const;
 };
 
 #endif // STATICSEARCHER4_HPP
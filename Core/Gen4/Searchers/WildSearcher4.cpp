@@ -58,10 +58,7 @@ WildSearcher4::WildSearcher4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u32 m
     WildSearcher(method, lead, area, profile, filter),
     unlockedUnown(profile.getUnlockedUnownForms()),
     undiscoveredUnown(profile.getUndiscoveredUnownForms(unlockedUnown)),
-    maxAdvance(maxAdvance),
-    minAdvance(minAdvance),
-    maxDelay(maxDelay),
-    minDelay(minDelay),
+    initialSeeds(minAdvance, maxAdvance, minDelay, maxDelay),
     thresh(area.getRate()),
     feebas(area.feebasLocation(profile.getVersion())
            && (area.getEncounter() == Encounter::OldRod || area.getEncounter() == Encounter::GoodRod
@@ -90,65 +87,41 @@ WildSearcher4::WildSearcher4(u32 minAdvance, u32 maxAdvance, u32 minDelay, u32 m
     }
 }
 
-void WildSearcher4::startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max, u8 index)
+void WildSearcher4::startSearch(int threads, const std::array<u8, 6> &min, const std::array<u8, 6> &max, u8 index)
 {
     searching = true;
 
-    for (u8 hp = min[0]; hp <= max[0]; hp++)
-    {
-        for (u8 atk = min[1]; atk <= max[1]; atk++)
-        {
-            for (u8 def = min[2]; def <= max[2]; def++)
-            {
-                for (u8 spa = min[3]; spa <= max[3]; spa++)
-                {
-                    for (u8 spd = min[4]; spd <= max[4]; spd++)
-                    {
-                        for (u8 spe = min[5]; spe <= max[5]; spe++)
-                        {
-                            if (!searching)
-                            {
-                                return;
-                            }
-
-                            auto states = search(hp, atk, def, spa, spd, spe, index);
-
-                            std::lock_guard<std::mutex> guard(mutex);
-                            results.insert(results.end(), states.begin(), states.end());
-                            progress++;
-                        }
-                    }
-                }
-            }
-        }
-    }
+    searchIVs(threads, min, max, Method::Method1, [this, index](const std::array<u8, 6> &ivs, const RecoverySeeds<6> &seeds) {
+        return search(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], seeds, index);
+    });
 }
 
-std::vector<WildSearcherState4> WildSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const
+std::vector<WildSearcherState4> WildSearcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                      u8 index) const
 {
     std::vector<WildSearcherState4> states;
 
     if (method == Method::MethodJ)
     {
-        states = searchMethodJ(hp, atk, def, spa, spd, spe);
+        states = searchMethodJ(hp, atk, def, spa, spd, spe, seeds);
     }
     else if (method == Method::MethodK)
     {
-        states = searchMethodK(hp, atk, def, spa, spd, spe);
+        states = searchMethodK(hp, atk, def, spa, spd, spe, seeds);
     }
     else if (method == Method::HoneyTree)
     {
-        states = searchHoneyTree(hp, atk, def, spa, spd, spe, index);
+        states = searchHoneyTree(hp, atk, def, spa, spd, spe, seeds, index);
     }
     else if (method == Method::PokeRadar)
     {
         if (shiny)
         {
-            states = searchPokeRadarShiny(hp, atk, def, spa, spd, spe, index);
+            states = searchPokeRadarShiny(hp, atk, def, spa, spd, spe, seeds, index);
         }
         else
         {
-            states = searchPokeRadar(hp, atk, def, spa, spd, spe, index);
+            states = searchPokeRadar(hp, atk, def, spa, spd, spe, seeds, index);
         }
     }
 
@@ -159,31 +132,24 @@ std::vector<WildSearcherState4> WildSearcher4::searchInitialSeeds(const std::vec
 {
     std::vector<WildSearcherState4> states;
 
+    std::vector<std::pair<u32, u32>> seeds;
     for (WildSearcherState4 result : results)
     {
-        PokeRNGR rng(result.getSeed(), minAdvance);
-        u32 seed = rng.getSeed();
-        for (u32 cnt = minAdvance; cnt <= maxAdvance; cnt++)
+        seeds.clear();
+        initialSeeds.search(result.getSeed(), seeds);
+        for (const auto &[seed, advances] : seeds)
         {
-            u8 hour = (seed >> 16) & 0xFF;
-            u16 delay = seed & 0xFFFF;
-
-            // Check if seed matches a valid gen 4 format
-            if (hour < 24 && delay >= minDelay && delay <= maxDelay)
-            {
-                result.setSeed(seed);
-                result.setAdvances(cnt);
-                states.emplace_back(result);
-            }
-
-            seed = rng.next();
+            result.setSeed(seed);
+            result.setAdvances(advances);
+            states.emplace_back(result);
         }
     }
 
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
+std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+                                                             const RecoverySeeds<6> &seeds) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -192,7 +158,6 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
     bool nibble = area.getEncounter() == Encounter::OldRod || area.getEncounter() == Encounter::GoodRod
         || area.getEncounter() == Encounter::SuperRod;
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -579,7 +544,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodJ(u8 hp, u8 atk, u8 d
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
+std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+                                                             const RecoverySeeds<6> &seeds) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -588,7 +554,6 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
     bool nibble = area.getEncounter() == Encounter::RockSmash || area.getEncounter() == Encounter::OldRod
         || area.getEncounter() == Encounter::GoodRod || area.getEncounter() == Encounter::SuperRod;
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -861,7 +826,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchMethodK(u8 hp, u8 atk, u8 d
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchHoneyTree(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const
+std::vector<WildSearcherState4> WildSearcher4::searchHoneyTree(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+                                                               const RecoverySeeds<6> &seeds, u8 index) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -880,7 +846,6 @@ std::vector<WildSearcherState4> WildSearcher4::searchHoneyTree(u8 hp, u8 atk, u8
         }
     }
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -986,7 +951,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchHoneyTree(u8 hp, u8 atk, u8
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const
+std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+                                                               const RecoverySeeds<6> &seeds, u8 index) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -1005,7 +971,6 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8
         }
     }
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
@@ -1097,7 +1062,8 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadar(u8 hp, u8 atk, u8
     return states;
 }
 
-std::vector<WildSearcherState4> WildSearcher4::searchPokeRadarShiny(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const
+std::vector<WildSearcherState4> WildSearcher4::searchPokeRadarShiny(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe,
+                                                                    const RecoverySeeds<6> &seeds, u8 index) const
 {
     std::vector<WildSearcherState4> states;
 
@@ -1115,7 +1081,6 @@ std::vector<WildSearcherState4> WildSearcher4::searchPokeRadarShiny(u8 hp, u8 at
         return (pid & 0xff) < info->getGender();
     };
 
-    auto seeds = LCRNGReverse::recoverPokeRNGIV(hp, atk, def, spa, spd, spe, Method::Method1);
     for (int i = 0; i < seeds.count; i++)
     {
         PokeRNGR rng(seeds[i]);
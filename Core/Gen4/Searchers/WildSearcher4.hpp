@@ -21,6 +21,7 @@
 #define WILDSEARCHER4_HPP
 
 #include <Core/Gen4/EncounterArea4.hpp>
+#include <Core/Gen4/InitialSeedFinder4.hpp>
 #include <Core/Gen4/Profile4.hpp>
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/Parents/Searchers/WildSearcher.hpp>
@@ -54,21 +55,19 @@ public:
                   bool unownRadio, u8 happiness, const EncounterArea4 &area, const Profile4 &profile, const WildStateFilter &filter);
 
     /**
-     * @brief Starts the search
+     * @brief Starts the search. The IV range is split between \p threads threads.
      *
+     * @param threads Number of threads to search with
      * @param min Minimum IVs
      * @param max Maximum IVs
      * @param index Pokeradar slot index
      */
-    void startSearch(const std::array<u8, 6> &min, const std::array<u8, 6> &max, u8 index);
+    void startSearch(int threads, const std::array<u8, 6> &min, const std::array<u8, 6> &max, u8 index);
 
 private:
     std::vector<u8> unlockedUnown;
     std::vector<u8> undiscoveredUnown;
-    u32 maxAdvance;
-    u32 minAdvance;
-    u32 maxDelay;
-    u32 minDelay;
+    InitialSeedFinder4 initialSeeds;
     u16 thresh;
     bool feebas;
     bool feebasTile;
@@ -86,11 +85,12 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      * @param index Pokeradar slot index
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const;
+    std::vector<WildSearcherState4> search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds, u8 index) const;
 
     /**
      * @brief Searches for initial seeds within min/max advances and min/max delay
@@ -110,10 +110,11 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
+    std::vector<WildSearcherState4> searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Method K
@@ -124,10 +125,11 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
+    std::vector<WildSearcherState4> searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Honey Tree
@@ -138,10 +140,12 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchHoneyTree(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const;
+    std::vector<WildSearcherState4> searchHoneyTree(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                    u8 index) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Poke Radar
@@ -152,10 +156,12 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchPokeRadar(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const;
+    std::vector<WildSearcherState4> searchPokeRadar(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                    u8 index) const;
 
     /**
      * @brief Searches for matching states from provided IVs via Poke Radar chained shiny
@@ -166,10 +172,12 @@ private:
      * @param spa SpA IV
      * @param spd SpD IV
      * @param spe Spe IV
+     * @param seeds Origin seeds of the IVs
      *
      * @return Vector of computed states
      */
-    std::vector<WildSearcherState4> searchPokeRadarShiny(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 index) const;
+    std::vector<WildSearcherState4> searchPokeRadarShiny(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, const RecoverySeeds<6> &seeds,
+                                                         u8 index) const;
 };
 
 #endif // WILDSEARCHER4_HPP
@@ -0,0 +1,65 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IVCacheFilter.hpp"
+#include <Core/Gen5/IVCache.hpp>
+#include <bit>
+
+IVCacheFilter::IVCacheFilter(const std::vector<u32> &entralink, const std::vector<u32> &normal, const std::vector<u32> &roamer)
+{
+    std::vector<u64> entries;
+    entries.reserve(entralink.size() + normal.size() + roamer.size());
+    for (u32 seed : entralink)
+    {
+        entries.emplace_back((static_cast<u64>(seed) << 8) | (1 << static_cast<u8>(CacheType::Entralink)));
+    }
+    for (u32 seed : normal)
+    {
+        entries.emplace_back((static_cast<u64>(seed) << 8) | (1 << static_cast<u8>(CacheType::Normal)));
+    }
+    for (u32 seed : roamer)
+    {
+        entries.emplace_back((static_cast<u64>(seed) << 8) | (1 << static_cast<u8>(CacheType::Roamer)));
+    }
+    std::ranges::sort(entries);
+
+    // Merge seeds that appear in multiple cache types
+    for (u64 entry : entries)
+    {
+        u32 seed = entry >> 8;
+        if (!seeds.empty() && seeds.back() == seed)
+        {
+            types.back() |= entry & 0xff;
+        }
+        else
+        {
+            seeds.emplace_back(seed);
+            types.emplace_back(entry & 0xff);
+        }
+    }
+
+    // Roughly 16 bits per seed keeps the false positive rate of 4 bits per block below 1%
+    u32 blocks = std::bit_ceil(std::max<size_t>(seeds.size() / 4, 64));
+    shift = 64 - std::countr_zero(blocks);
+    bloom.resize(blocks);
+    for (u32 seed : seeds)
+    {
+        bloom[getBlock(seed)] |= getMask(seed);
+    }
+}
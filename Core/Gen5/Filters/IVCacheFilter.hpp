@@ -0,0 +1,105 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef IVCACHEFILTER_HPP
+#define IVCACHEFILTER_HPP
+
+#include <Core/Global.hpp>
+#include <algorithm>
+#include <vector>
+
+enum class CacheType : u8;
+
+/**
+ * @brief Combined membership filter of the entralink, normal, and roamer seeds of an IV cache.
+ * A blocked bloom filter rejects almost every seed with a single 64bit load. Seeds that pass are confirmed against the merged seed
+ * list, which also gives the cache types the seed belongs to.
+ */
+class IVCacheFilter
+{
+public:
+    /**
+     * @brief Construct a new IVCacheFilter object
+     *
+     * @param entralink Sorted entralink seeds
+     * @param normal Sorted normal seeds
+     * @param roamer Sorted roamer seeds
+     */
+    IVCacheFilter(const std::vector<u32> &entralink, const std::vector<u32> &normal, const std::vector<u32> &roamer);
+
+    /**
+     * @brief Checks if the seed might be part of the IV cache. False positives are possible, false negatives are not.
+     *
+     * @param seed Upper 32bits of the PRNG state
+     *
+     * @return true Seed might be in the cache
+     * @return false Seed is not in the cache
+     */
+    bool mayContain(u32 seed) const
+    {
+        u64 mask = getMask(seed);
+        return (bloom[getBlock(seed)] & mask) == mask;
+    }
+
+    /**
+     * @brief Gets the cache types the seed belongs to
+     *
+     * @param seed Upper 32bits of the PRNG state
+     *
+     * @return Bit mask of the cache types, indexed by CacheType
+     */
+    u8 getTypes(u32 seed) const
+    {
+        auto it = std::ranges::lower_bound(seeds, seed);
+        return it != seeds.end() && *it == seed ? types[it - seeds.begin()] : 0;
+    }
+
+private:
+    std::vector<u64> bloom;
+    std::vector<u32> seeds;
+    std::vector<u8> types;
+    u8 shift;
+
+    /**
+     * @brief Computes the bloom filter block of the seed
+     *
+     * @param seed Upper 32bits of the PRNG state
+     *
+     * @return Block index
+     */
+    u32 getBlock(u32 seed) const
+    {
+        return static_cast<u32>((seed * 0x9e3779b97f4a7c15) >> shift);
+    }
+
+    /**
+     * @brief Computes the bits of the seed within its bloom filter block
+     *
+     * @param seed Upper 32bits of the PRNG state
+     *
+     * @return Block bits
+     */
+    static u64 getMask(u32 seed)
+    {
+        u64 hash = seed * 0xc2b2ae3d27d4eb4f;
+        return (1ull << (hash >> 58)) | (1ull << ((hash >> 52) & 63)) | (1ull << ((hash >> 46) & 63)) | (1ull << ((hash >> 40) & 63));
+    }
+};
+
+#endif // IVCACHEFILTER_HPP
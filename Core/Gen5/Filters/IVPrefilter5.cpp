@@ -0,0 +1,145 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IVPrefilter5.hpp"
+#include <Core/RNG/MT.hpp>
+#include <Core/RNG/MTFast.hpp>
+#include <algorithm>
+
+IVPrefilter5::IVPrefilter5(u32 initialAdvances, u32 maxAdvances, u32 offset, bool roamer, const StateFilter &filter) :
+    stateFilter(filter), initialAdvances(initialAdvances), maxAdvances(maxAdvances), offset(offset)
+{
+    if (roamer)
+    {
+        order = { 0, 1, 2, 4, 5, 3 };
+    }
+    else
+    {
+        order = { 0, 1, 2, 3, 4, 5 };
+    }
+}
+
+void IVPrefilter5::filter(const u64 *seeds, u8 count, std::vector<std::pair<u32, std::array<u8, 6>>> *ivs) const
+{
+    u32 size = offset + maxAdvances + 6;
+    if (size <= 16)
+    {
+        filter<16>(seeds, count, ivs);
+    }
+    else if (size <= 32)
+    {
+        filter<32>(seeds, count, ivs);
+    }
+    else if (size <= 64)
+    {
+        filter<64>(seeds, count, ivs);
+    }
+    else if (size <= 128)
+    {
+        filter<128>(seeds, count, ivs);
+    }
+    else if (size <= 226)
+    {
+        filter<226>(seeds, count, ivs);
+    }
+    else
+    {
+        // Too many advances for MTFast, fallback to computing each seed with MT
+        std::vector<u8> rands(maxAdvances + 6);
+        for (u8 i = 0; i < count; i++)
+        {
+            ivs[i].clear();
+
+            MT rng(seeds[i] >> 32, offset);
+            std::ranges::generate(rands, [&rng] { return rng.next() >> 27; });
+
+            for (u32 cnt = 0; cnt <= maxAdvances; cnt++)
+            {
+                std::array<u8, 6> iv;
+                for (u8 j = 0; j < 6; j++)
+                {
+                    iv[order[j]] = rands[cnt + j];
+                }
+
+                if (stateFilter.compareIV(iv))
+                {
+                    ivs[i].emplace_back(initialAdvances + cnt, iv);
+                }
+            }
+        }
+    }
+}
+
+template <u16 size>
+void IVPrefilter5::filter(const u64 *seeds, u8 count, std::vector<std::pair<u32, std::array<u8, 6>>> *ivs) const
+{
+#ifdef SIMD_X86
+    if (hasAVX2())
+    {
+        filter<size, vuint256>(seeds, count, ivs);
+    }
+    else
+#endif
+    {
+        filter<size, vuint128>(seeds, count, ivs);
+    }
+}
+
+template <u16 size, class Vector>
+void IVPrefilter5::filter(const u64 *seeds, u8 count, std::vector<std::pair<u32, std::array<u8, 6>>> *ivs) const
+{
+    constexpr u8 lanes = sizeof(Vector) / sizeof(u32);
+
+    Vector rands[size];
+    for (u8 i = 0; i < count; i += lanes)
+    {
+        // Lanes past the end of the seeds repeat the last seed and are discarded
+        Vector seed(0);
+        for (u8 j = 0; j < lanes; j++)
+        {
+            seed.uint32[j] = seeds[std::min<u8>(i + j, count - 1)] >> 32;
+        }
+
+        MTFastMulti<size, true, Vector> rng(seed, offset);
+        for (u32 j = 0; j < maxAdvances + 6; j++)
+        {
+            rands[j] = rng.next();
+        }
+
+        for (u8 k = 0; k < lanes && (i + k) < count; k++)
+        {
+            auto &list = ivs[i + k];
+            list.clear();
+
+            for (u32 cnt = 0; cnt <= maxAdvances; cnt++)
+            {
+                std::array<u8, 6> iv;
+                for (u8 j = 0; j < 6; j++)
+                {
+                    iv[order[j]] = rands[cnt + j].uint32[k];
+                }
+
+                if (stateFilter.compareIV(iv))
+                {
+                    list.emplace_back(initialAdvances + cnt, iv);
+                }
+            }
+        }
+    }
+}
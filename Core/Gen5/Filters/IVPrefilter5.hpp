@@ -0,0 +1,85 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef IVPREFILTER5_HPP
+#define IVPREFILTER5_HPP
+
+#include <Core/Global.hpp>
+#include <Core/Parents/Filters/StateFilter.hpp>
+#include <array>
+#include <vector>
+
+/**
+ * @brief Computes the IVs of multiple seeds at once and rejects the seeds that can't pass the IV filter before they reach a generator
+ */
+class IVPrefilter5
+{
+public:
+    /**
+     * @brief Construct a new IVPrefilter5 object
+     *
+     * @param initialAdvances Initial IV advances
+     * @param maxAdvances Maximum IV advances
+     * @param offset Number of MT advances before the first IV of \p initialAdvances
+     * @param roamer Whether the IVs are generated in roamer order
+     * @param filter State filter
+     */
+    IVPrefilter5(u32 initialAdvances, u32 maxAdvances, u32 offset, bool roamer, const StateFilter &filter);
+
+    /**
+     * @brief Computes the IVs of each seed and stores the IV advances that pass the filter
+     *
+     * @param seeds PRNG states
+     * @param count Number of PRNG states
+     * @param ivs Passing IV advances of each seed
+     */
+    void filter(const u64 *seeds, u8 count, std::vector<std::pair<u32, std::array<u8, 6>>> *ivs) const;
+
+private:
+    StateFilter stateFilter;
+    std::array<u8, 6> order;
+    u32 initialAdvances;
+    u32 maxAdvances;
+    u32 offset;
+
+    /**
+     * @brief Computes the IVs of each seed with \p size MT values per seed, 8 seeds at a time when AVX2 is available
+     *
+     * @tparam size Number of MT values to generate
+     * @param seeds PRNG states
+     * @param count Number of PRNG states
+     * @param ivs Passing IV advances of each seed
+     */
+    template <u16 size>
+    void filter(const u64 *seeds, u8 count, std::vector<std::pair<u32, std::array<u8, 6>>> *ivs) const;
+
+    /**
+     * @brief Computes the IVs of each seed with \p size MT values per seed and the seeds spread over the lanes of \p Vector
+     *
+     * @tparam size Number of MT values to generate
+     * @tparam Vector SIMD vector type, which decides the number of seeds per MT
+     * @param seeds PRNG states
+     * @param count Number of PRNG states
+     * @param ivs Passing IV advances of each seed
+     */
+    template <u16 size, class Vector>
+    void filter(const u64 *seeds, u8 count, std::vector<std::pair<u32, std::array<u8, 6>>> *ivs) const;
+};
+
+#endif // IVPREFILTER5_HPP
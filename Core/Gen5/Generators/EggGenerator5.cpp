@@ -20,7 +20,6 @@
 #include "EggGenerator5.hpp"
 #include <Core/Enum/Game.hpp>
 #include <Core/Enum/Method.hpp>
-#include <Core/Enum/Shiny.hpp>
 #include <Core/Gen5/States/EggState5.hpp>
 #include <Core/Parents/PersonalInfo.hpp>
 #include <Core/Parents/PersonalLoader.hpp>
@@ -28,16 +27,165 @@
 #include <Core/RNG/MTFast.hpp>
 #include <Core/Util/Utilities.hpp>
 #include <algorithm>
+#include <type_traits>
+
+/**
+ * @brief Loads consecutive values into the lanes of \p Vector
+ *
+ * @tparam Vector SIMD vector type
+ * @param address Memory address
+ *
+ * @return Loaded vector
+ */
+template <class Vector>
+static Vector load(const u32 *address)
+{
+#ifdef SIMD_X86
+    if constexpr (std::is_same_v<Vector, vuint256>)
+    {
+        return v32x8_load(address);
+    }
+    else
+#endif
+    {
+        return v32x4_load(address);
+    }
+}
+
+/**
+ * @brief Computes the Black 2/White 2 PID of every advance of the window with consecutive advances in the lanes of \p Vector
+ *
+ * @tparam Vector SIMD vector type
+ * @param values Upper 32bits of the window states, with at least 2 + \p rolls + lanes states past the last advance
+ * @param count Number of advances in the window
+ * @param rolls Number of PID rerolls
+ * @param tsv Trainer shiny value
+ * @param ability Ability of the egg, which is forced into the PID
+ * @param pids PID of each advance, with room for lanes PIDs past the last advance
+ */
+template <class Vector>
+static void computePIDs(const u32 *values, u32 count, u8 rolls, u16 tsv, u8 ability, u32 *pids)
+{
+    constexpr u8 lanes = sizeof(Vector) / sizeof(u32);
+
+    Vector mask(0xfffeffff);
+    Vector bit(ability << 16);
+    Vector psvMask(0xfff8);
+    Vector trainer(tsv);
+    Vector zero(0);
+
+    // Matches Utilities5::createPID with the ability bit forced and no gender
+    auto getPID = [&](const u32 *address) { return (load<Vector>(address) & mask) | bit; };
+    auto isShiny = [&](Vector pid) { return ((pid ^ (pid >> 16) ^ trainer) & psvMask) == zero; };
+
+    for (u32 cnt = 0; cnt < count; cnt += lanes)
+    {
+        // Temp PID/Nature
+        const u32 *address = values + cnt + 2;
+
+        // Lanes keep the first shiny PID, or the last reroll if none are shiny
+        Vector pid = getPID(address);
+        Vector reroll = ~isShiny(pid);
+        for (u8 i = 1; i <= rolls; i++)
+        {
+            Vector next = getPID(address + i);
+            pid = (pid & ~reroll) | (next & reroll);
+            reroll = reroll & ~isShiny(next);
+        }
+
+        std::copy_n(pid.uint32, lanes, pids + cnt);
+    }
+}
+
+/**
+ * @brief Computes the first \p values MT results of each seed with the seeds spread over the lanes of \p Vector
+ *
+ * @tparam size Number of values to have generated
+ * @tparam fast Whether to skip last bit shift operations
+ * @tparam Vector SIMD vector type, which decides the number of seeds per MT
+ * @param seeds Starting PRNG states
+ * @param count Number of seeds
+ * @param advances Number of initial MT advances
+ * @param values Number of MT results per seed
+ * @param results MT results of each seed, stored one seed after another
+ */
+template <u16 size, bool fast, class Vector>
+static void computeMT(const u64 *seeds, u8 count, u32 advances, u8 values, u32 *results)
+{
+    constexpr u8 lanes = sizeof(Vector) / sizeof(u32);
+
+    for (u8 start = 0; start < count; start += lanes)
+    {
+        Vector seed(0);
+        for (u8 i = 0; i < lanes && start + i < count; i++)
+        {
+            seed.uint32[i] = seeds[start + i] >> 32;
+        }
+
+        MTFastMulti<size, fast, Vector> mt(seed, advances);
+        for (u8 j = 0; j < values; j++)
+        {
+            Vector result = mt.next();
+            for (u8 i = 0; i < lanes && start + i < count; i++)
+            {
+                results[(start + i) * values + j] = result.uint32[i];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Computes the first \p values MT results of each seed, 8 seeds at a time when AVX2 is available
+ *
+ * @tparam size Number of values to have generated
+ * @tparam fast Whether to skip last bit shift operations
+ * @param seeds Starting PRNG states
+ * @param count Number of seeds
+ * @param advances Number of initial MT advances
+ * @param values Number of MT results per seed
+ * @param results MT results of each seed, stored one seed after another
+ */
+template <u16 size, bool fast>
+static void computeMT(const u64 *seeds, u8 count, u32 advances, u8 values, u32 *results)
+{
+#ifdef SIMD_X86
+    if (hasAVX2())
+    {
+        computeMT<size, fast, vuint256>(seeds, count, advances, values, results);
+    }
+    else
+#endif
+    {
+        computeMT<size, fast, vuint128>(seeds, count, advances, values, results);
+    }
+}
 
 EggGenerator5::EggGenerator5(u32 initialAdvances, u32 maxAdvances, u32 offset, const Daycare &daycare, const Profile5 &profile,
                              const StateFilter &filter) :
     EggGenerator(initialAdvances, maxAdvances, offset, Method::None, 0, daycare, profile, filter),
+    base(PersonalLoader::getPersonal(profile.getVersion(), daycare.getEggSpecie())),
+    female(base),
+    male(base),
     ditto(daycare.getDitto()),
     everstone(daycare.getEverstoneCount()),
+    everstoneNature(daycare.getParentNature(daycare.getParentItem(0) == 1 ? 0 : 1)),
     parentAbility(daycare.getParentAbility(1)),
     poweritem(daycare.getPowerItemCount()),
+    poweritemParent((daycare.getParentItem(0) >= 2 && daycare.getParentItem(0) <= 7) ? 0 : 1),
     rolls(((profile.getVersion() & Game::BW2) != Game::None && profile.getShinyCharm() ? 2 : 0) + (daycare.getMasuda() ? 5 : 0))
 {
+    // Nidoran
+    // Volbeat / Illumise
+    if (daycare.getEggSpecie() == 29 || daycare.getEggSpecie() == 32)
+    {
+        female = PersonalLoader::getPersonal(profile.getVersion(), 29);
+        male = PersonalLoader::getPersonal(profile.getVersion(), 32);
+    }
+    else if (daycare.getEggSpecie() == 313 || daycare.getEggSpecie() == 314)
+    {
+        female = PersonalLoader::getPersonal(profile.getVersion(), 314);
+        male = PersonalLoader::getPersonal(profile.getVersion(), 313);
+    }
 }
 
 std::vector<EggState5> EggGenerator5::generate(u64 seed) const
@@ -46,40 +194,95 @@ std::vector<EggState5> EggGenerator5::generate(u64 seed) const
     {
     case Game::Black:
     case Game::White:
-        return generateBW(seed);
+    {
+        MTFast<13, true> mt(seed >> 32, 7);
+        std::array<u8, 6> mtIVs;
+        std::ranges::generate(mtIVs, [&mt] { return mt.next(); });
+
+        return generateBW(seed, Utilities5::initialAdvances(seed, profile), mtIVs);
+    }
     case Game::Black2:
     case Game::White2:
-        return generateBW2(seed);
+    {
+        MTFast<4> mt(seed >> 32, 2);
+
+        u64 eggSeed = static_cast<u64>(mt.next()) << 32;
+        eggSeed |= mt.next();
+
+        return generateBW2(seed, eggSeed);
+    }
     default:
         return std::vector<EggState5>();
     }
 }
 
-std::vector<EggState5> EggGenerator5::generateBW(u64 seed) const
+void EggGenerator5::generate(const u64 *seeds, u8 count, std::vector<EggState5> *states) const
 {
-    const PersonalInfo *base = PersonalLoader::getPersonal(profile.getVersion(), daycare.getEggSpecie());
-    const PersonalInfo *male;
-    const PersonalInfo *female;
-    if (daycare.getEggSpecie() == 29 || daycare.getEggSpecie() == 32)
+    switch (profile.getVersion())
     {
-        male = PersonalLoader::getPersonal(profile.getVersion(), 32);
-        female = PersonalLoader::getPersonal(profile.getVersion(), 29);
-    }
-    else if (daycare.getEggSpecie() == 313 || daycare.getEggSpecie() == 314)
+    case Game::Black:
+    case Game::White:
     {
-        male = PersonalLoader::getPersonal(profile.getVersion(), 313);
-        female = PersonalLoader::getPersonal(profile.getVersion(), 314);
+        std::array<u32, 16 * 6> mtIVs;
+        computeMT<13, true>(seeds, count, 7, 6, mtIVs.data());
+
+        std::array<u32, 16> advances;
+        Utilities5::initialAdvances(seeds, count, profile, advances.data());
+
+        for (u8 i = 0; i < count; i++)
+        {
+            std::array<u8, 6> ivs;
+            std::copy_n(&mtIVs[i * 6], 6, ivs.begin());
+            states[i] = generateBW(seeds[i], advances[i], ivs);
+        }
+        break;
     }
+    case Game::Black2:
+    case Game::White2:
+    {
+        std::array<u32, 16 * 2> mt;
+        computeMT<4, false>(seeds, count, 2, 2, mt.data());
 
-    MTFast<13, true> mt(seed >> 32, 7);
-    std::array<u8, 6> mtIVs;
-    std::ranges::generate(mtIVs, [&mt] { return mt.next(); });
+        for (u8 i = 0; i < count; i++)
+        {
+            u64 eggSeed = static_cast<u64>(mt[i * 2]) << 32;
+            eggSeed |= mt[i * 2 + 1];
 
-    u32 advances = Utilities5::initialAdvances(seed, profile);
+            states[i] = generateBW2(seeds[i], eggSeed);
+        }
+        break;
+    }
+    default:
+        std::fill_n(states, count, std::vector<EggState5>());
+        break;
+    }
+}
+
+std::vector<EggState5> EggGenerator5::generateBW(u64 seed, u32 advances, const std::array<u8, 6> &mtIVs) const
+{
     BWRNG rng(seed, advances + initialAdvances);
     auto jump = rng.getJump(offset);
 
     std::vector<EggState5> states;
+
+    // The PID, nature, ability and IVs reject most states, so they are checked before the state is built
+    auto addState = [&](u32 cnt, u32 prng, u32 pid, u8 nature, bool hiddenAbility, const std::array<u8, 6> &ivs,
+                        const std::array<u8, 6> &inheritance, const PersonalInfo *info) {
+        u8 ability = hiddenAbility ? 2 : ((pid >> 16) & 1);
+        u8 shiny = Utilities::getShiny<true>(pid, tsv);
+        if (!filter.compareShiny(shiny) || !filter.compareNature(nature) || !filter.compareAbility(ability) || !filter.compareIV(ivs))
+        {
+            return;
+        }
+
+        EggState5 state(prng, advances + initialAdvances + cnt, pid, ivs, ability, Utilities::getGender(pid, info), nature, shiny,
+                        inheritance, info);
+        if (filter.compareState(static_cast<const State &>(state)))
+        {
+            states.emplace_back(state);
+        }
+    };
+
     for (u32 cnt = 0; cnt <= maxAdvances; cnt++)
     {
         BWRNG go(rng, jump);
@@ -110,8 +313,7 @@ std::vector<EggState5> EggGenerator5::generateBW(u64 seed) const
             }
             else
             {
-                u8 parent = daycare.getParentItem(0) == 1 ? 0 : 1;
-                nature = daycare.getParentNature(parent);
+                nature = everstoneNature;
             }
         }
 
@@ -133,22 +335,12 @@ std::vector<EggState5> EggGenerator5::generateBW(u64 seed) const
         if (poweritem != 0)
         {
             inheritanceCount = 1;
-            if (poweritem == 2)
-            {
-                u8 parent = go.nextUInt(2);
-                u8 item = daycare.getParentItem(parent);
 
-                ivs[item - 2] = daycare.getParentIV(parent, item - 2);
-                inheritance[item - 2] = parent + 1;
-            }
-            else
-            {
-                u8 parent = (daycare.getParentItem(0) >= 2 && daycare.getParentItem(0) <= 7) ? 0 : 1;
-                u8 item = daycare.getParentItem(parent);
+            u8 parent = poweritem == 2 ? go.nextUInt(2) : poweritemParent;
+            u8 item = daycare.getParentItem(parent);
 
-                ivs[item - 2] = daycare.getParentIV(parent, item - 2);
-                inheritance[item - 2] = parent + 1;
-            }
+            ivs[item - 2] = daycare.getParentIV(parent, item - 2);
+            inheritance[item - 2] = parent + 1;
         }
 
         // IV Inheritance
@@ -172,28 +364,16 @@ std::vector<EggState5> EggGenerator5::generateBW(u64 seed) const
             pid = go.nextUInt(0xffffffff);
         }
 
-        u8 ability = hiddenAbility ? 2 : ((pid >> 16) & 1);
-
-        EggState5 state(rng.nextUInt(), advances + initialAdvances + cnt, pid, ivs, ability, Utilities::getGender(pid, info), nature,
-                        Utilities::getShiny<true>(pid, tsv), inheritance, info);
-        if (filter.compareState(static_cast<const State &>(state)))
-        {
-            states.emplace_back(state);
-        }
+        addState(cnt, rng.nextUInt(), pid, nature, hiddenAbility, ivs, inheritance, info);
     }
 
     return states;
 }
 
-std::vector<EggState5> EggGenerator5::generateBW2(u64 seed) const
+std::vector<EggState5> EggGenerator5::generateBW2(u64 seed, u64 eggSeed) const
 {
     std::vector<EggState5> states;
 
-    MTFast<4> mt(seed >> 32, 2);
-
-    u64 eggSeed = static_cast<u64>(mt.next()) << 32;
-    eggSeed |= mt.next();
-
     const PersonalInfo *info = nullptr;
     EggState5 state = generateBW2Egg(eggSeed, &info);
     u8 ability = state.getAbility() == 2 ? 0 : state.getAbility();
@@ -205,22 +385,38 @@ std::vector<EggState5> EggGenerator5::generateBW2(u64 seed) const
         BWRNG rng(seed, advances + initialAdvances);
         auto jump = rng.getJump(offset);
 
-        for (u32 cnt = 0; cnt <= maxAdvances; cnt++)
+        // Each advance of the window starts one state after the previous advance, so the states are computed once for the whole window.
+        // Every advance draws at most 3 + rolls states, and the extra 8 states and PIDs cover the unused lanes past the window.
+        u32 count = maxAdvances + 1;
+        std::vector<u32> values(count + 3 + rolls + 8);
+        BWRNG go(rng, jump);
+        std::ranges::generate(values, [&go] { return go.nextUInt(); });
+
+        std::vector<u32> pids(count + 8);
+#ifdef SIMD_X86
+        if (hasAVX2())
         {
-            BWRNG go(rng, jump);
+            computePIDs<vuint256>(values.data(), count, rolls, tsv, ability, pids.data());
+        }
+        else
+#endif
+        {
+            computePIDs<vuint128>(values.data(), count, rolls, tsv, ability, pids.data());
+        }
 
-            // Temp PID/Nature
-            go.advance(2);
+        for (u32 cnt = 0; cnt <= maxAdvances; cnt++)
+        {
+            u32 prng = rng.nextUInt();
+            u32 pid = pids[cnt];
 
-            u32 pid = Utilities5::createPID(tsv, ability, 255, Shiny::Random, false, info->getGender(), go);
-            for (u8 i = 0; i < rolls && !Utilities::isShiny<true>(pid, tsv); i++)
+            u8 shiny = Utilities::getShiny<true>(pid, tsv);
+            if (!filter.compareShiny(shiny))
             {
-                pid = Utilities5::createPID(tsv, ability, 255, Shiny::Random, false, info->getGender(), go);
+                continue;
             }
 
-            state.update(rng.nextUInt(), advances + initialAdvances + cnt, pid, Utilities::getGender(pid, info),
-                         Utilities::getShiny<true>(pid, tsv));
-            if (filter.compareGender(state.getGender()) && filter.compareShiny(state.getShiny()))
+            state.update(prng, advances + initialAdvances + cnt, pid, Utilities::getGender(pid, info), shiny);
+            if (filter.compareGender(state.getGender()))
             {
                 states.emplace_back(state);
             }
@@ -238,29 +434,15 @@ EggState5 EggGenerator5::generateBW2Egg(u64 seed, const PersonalInfo **info) con
     // Volbeat / Illumise
     if (daycare.getEggSpecie() == 29 || daycare.getEggSpecie() == 32)
     {
-        if (rng.nextUInt(2))
-        {
-            *info = PersonalLoader::getPersonal(profile.getVersion(), 32);
-        }
-        else
-        {
-            *info = PersonalLoader::getPersonal(profile.getVersion(), 29);
-        }
+        *info = rng.nextUInt(2) ? male : female;
     }
     else if (daycare.getEggSpecie() == 313 || daycare.getEggSpecie() == 314)
     {
-        if (rng.nextUInt(2))
-        {
-            *info = PersonalLoader::getPersonal(profile.getVersion(), 314);
-        }
-        else
-        {
-            *info = PersonalLoader::getPersonal(profile.getVersion(), 313);
-        }
+        *info = rng.nextUInt(2) ? female : male;
     }
     else
     {
-        *info = PersonalLoader::getPersonal(profile.getVersion(), daycare.getEggSpecie());
+        *info = base;
     }
 
     u8 nature = rng.nextUInt(25);
@@ -272,8 +454,7 @@ EggState5 EggGenerator5::generateBW2Egg(u64 seed, const PersonalInfo **info) con
     }
     else if (everstone == 1)
     {
-        u8 parent = daycare.getParentItem(0) == 1 ? 0 : 1;
-        nature = daycare.getParentNature(parent);
+        nature = everstoneNature;
     }
 
     u8 ability;
@@ -306,22 +487,12 @@ EggState5 EggGenerator5::generateBW2Egg(u64 seed, const PersonalInfo **info) con
     if (poweritem != 0)
     {
         inheritanceCount = 1;
-        if (poweritem == 2)
-        {
-            u8 parent = rng.nextUInt(2);
-            u8 item = daycare.getParentItem(parent);
 
-            ivs[item - 2] = daycare.getParentIV(parent, item - 2);
-            inheritance[item - 2] = parent + 1;
-        }
-        else
-        {
-            u8 parent = (daycare.getParentItem(0) >= 2 && daycare.getParentItem(0) <= 7) ? 0 : 1;
-            u8 item = daycare.getParentItem(parent);
+        u8 parent = poweritem == 2 ? rng.nextUInt(2) : poweritemParent;
+        u8 item = daycare.getParentItem(parent);
 
-            ivs[item - 2] = daycare.getParentIV(parent, item - 2);
-            inheritance[item - 2] = parent + 1;
-        }
+        ivs[item - 2] = daycare.getParentIV(parent, item - 2);
+        inheritance[item - 2] = parent + 1;
     }
 
     // IV Inheritance
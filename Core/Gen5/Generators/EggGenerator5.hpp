@@ -55,15 +55,57 @@ public:
      */
     std::vector<EggState5> generate(u64 seed) const;
 
+    /**
+     * @brief Generates states of several seeds at once. The MT values and initial advances of the seeds are computed together in SIMD
+     * lanes.
+     *
+     * @param seeds Starting PRNG states
+     * @param count Number of seeds, at most 16
+     * @param states Vector of computed states of each seed
+     */
+    void generate(const u64 *seeds, u8 count, std::vector<EggState5> *states) const;
+
 private:
+    const PersonalInfo *base;
+    const PersonalInfo *female;
+    const PersonalInfo *male;
     bool ditto;
     u8 everstone;
+    u8 everstoneNature;
     u8 parentAbility;
     u8 poweritem;
+    u8 poweritemParent;
     u8 rolls;
 
-    std::vector<EggState5> generateBW(u64 seed) const;
-    std::vector<EggState5> generateBW2(u64 seed) const;
+    /**
+     * @brief Generates states for Black/White
+     *
+     * @param seed Starting PRNG state
+     * @param advances Initial advances of the seed
+     * @param mtIVs IVs from the MT of the seed
+     *
+     * @return Vector of computed states
+     */
+    std::vector<EggState5> generateBW(u64 seed, u32 advances, const std::array<u8, 6> &mtIVs) const;
+
+    /**
+     * @brief Generates states for Black 2/White 2
+     *
+     * @param seed Starting PRNG state
+     * @param eggSeed Egg seed from the MT of the seed
+     *
+     * @return Vector of computed states
+     */
+    std::vector<EggState5> generateBW2(u64 seed, u64 eggSeed) const;
+
+    /**
+     * @brief Generates the egg of the Black 2/White 2 egg seed
+     *
+     * @param seed Egg seed
+     * @param info Personal information of the egg
+     *
+     * @return Egg state without PID information
+     */
     EggState5 generateBW2Egg(u64 seed, const PersonalInfo **info) const;
 };
 
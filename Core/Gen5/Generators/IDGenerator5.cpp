@@ -29,11 +29,15 @@ IDGenerator5::IDGenerator5(u32 initialAdvances, u32 maxAdvances, u32 pid, bool c
 }
 
 std::vector<IDState> IDGenerator5::generate(u64 seed) const
+{
+    return generate(seed, Utilities5::initialAdvancesID(seed, profile.getVersion()));
+}
+
+std::vector<IDState> IDGenerator5::generate(u64 seed, u32 advances) const
 {
     bool pidBit = (pid >> 31) ^ (pid & 1);
     u16 psv = (pid >> 16) ^ (pid & 0xffff);
 
-    u32 advances = Utilities5::initialAdvancesID(seed, profile.getVersion());
     BWRNG rng(seed, advances + initialAdvances);
 
     std::vector<IDState> states;
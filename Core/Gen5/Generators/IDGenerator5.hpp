@@ -52,6 +52,16 @@ public:
      */
     std::vector<IDState> generate(u64 seed) const;
 
+    /**
+     * @brief Generates states with the initial ID advances already computed
+     *
+     * @param seed Starting PRNG state
+     * @param advances Initial ID advances of the \p seed
+     *
+     * @return Vector of computed states
+     */
+    std::vector<IDState> generate(u64 seed, u32 advances) const;
+
 private:
     Profile5 profile;
     u32 pid;
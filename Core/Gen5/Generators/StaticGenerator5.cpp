@@ -102,6 +102,14 @@ std::vector<State5> StaticGenerator5::generate(u64 seed, u32 initialAdvances, u3
     }
 }
 
+IVPrefilter5 StaticGenerator5::getIVPrefilter(u32 initialAdvances, u32 maxAdvances) const
+{
+    bool bw = (profile.getVersion() & Game::BW) != Game::None;
+    return IVPrefilter5(initialAdvances, maxAdvances,
+                        initialAdvances + (bw ? 0 : 2) + ((staticTemplate.getEgg() || staticTemplate.getRoamer()) ? 1 : 0),
+                        staticTemplate.getRoamer(), filter);
+}
+
 std::vector<State5> StaticGenerator5::generate(u64 seed, const std::vector<std::pair<u32, std::array<u8, 6>>> &ivs) const
 {
     if (staticTemplate.getWild())
@@ -124,6 +124,12 @@ std::vector<WildState5> WildGenerator5::generate(u64 seed, u32 initialAdvances,
     }
 }
 
+IVPrefilter5 WildGenerator5::getIVPrefilter(u32 initialAdvances, u32 maxAdvances) const
+{
+    bool bw = (profile.getVersion() & Game::BW) != Game::None;
+    return IVPrefilter5(initialAdvances, maxAdvances, initialAdvances + (bw ? 0 : 2), false, filter);
+}
+
 std::vector<WildState5> WildGenerator5::generate(u64 seed, const std::vector<std::pair<u32, std::array<u8, 6>>> &ivs) const
 {
     u32 advances = Utilities5::initialAdvances(seed, profile);
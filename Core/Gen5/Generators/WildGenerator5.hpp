@@ -21,6 +21,7 @@
 #define WILDGENERATOR5_HPP
 
 #include <Core/Gen5/EncounterArea5.hpp>
+#include <Core/Gen5/Filters/IVPrefilter5.hpp>
 #include <Core/Gen5/Profile5.hpp>
 #include <Core/Parents/Filters/StateFilter.hpp>
 #include <Core/Parents/Generators/WildGenerator.hpp>
@@ -57,6 +58,16 @@ public:
      */
     std::vector<WildState5> generate(u64 seed, u32 initialAdvances, u32 maxAdvances) const;
 
+    /**
+     * @brief Creates a prefilter that computes the same IVs as generate(u64, u32, u32) for multiple seeds at once
+     *
+     * @param initialAdvances Initial number of IV advances
+     * @param maxAdvances Maximum number of IV advances
+     *
+     * @return IV prefilter
+     */
+    IVPrefilter5 getIVPrefilter(u32 initialAdvances, u32 maxAdvances) const;
+
     /**
      * @brief Generates states for the \p encounterArea
      *
@@ -83,6 +83,21 @@ static std::array<u8, 6> computeIVs(u32 seed, u32 advance, CacheType type)
     return ivs;
 }
 
+const std::vector<u32> *IVCacheSeeds::getSeeds(std::vector<u32> &buffer) const
+{
+    if (compressed.empty())
+    {
+        return &seeds;
+    }
+
+    buffer.resize(count);
+    if (!Utilities::decompressValues(compressed.data(), compressed.size(), buffer.data(), count, true))
+    {
+        return nullptr;
+    }
+    return &buffer;
+}
+
 IVCache::IVCache(std::string_view file, bool read) : valid(false)
 {
     std::ifstream stream(file.data(), std::ios_base::in | std::ios_base::binary);
@@ -90,9 +105,10 @@ IVCache::IVCache(std::string_view file, bool read) : valid(false)
     {
         u32 magic;
 
-        // Expected magic word is CRC32 of "IVCache"
+        // Expected magic word is CRC32 of "IVCache" or CRC32 of "IVCacheZstd" when the seeds are compressed
         stream.read(reinterpret_cast<char *>(&magic), sizeof(magic));
-        if (magic != 0xd08cb7c0)
+        bool compressed = magic == 0x7576fc60;
+        if (magic != 0xd08cb7c0 && !compressed)
         {
             return;
         }
@@ -110,27 +126,60 @@ IVCache::IVCache(std::string_view file, bool read) : valid(false)
             stream.read(reinterpret_cast<char *>(normalCount.data()), normalCount.size() * sizeof(u32));
             stream.read(reinterpret_cast<char *>(roamerCount.data()), roamerCount.size() * sizeof(u32));
 
-            entralinkSeeds.resize(entralinkCount.size());
-            for (int i = 0; i < entralinkCount.size(); i++)
+            // Compressed caches store the compressed size of each advance after the seed counts
+            std::vector<u32> entralinkSize(entralinkCount.size());
+            std::vector<u32> normalSize(normalCount.size());
+            std::vector<u32> roamerSize(roamerCount.size());
+            if (compressed)
             {
-                entralinkSeeds[i].resize(entralinkCount[i]);
-                stream.read(reinterpret_cast<char *>(entralinkSeeds[i].data()), entralinkCount[i] * sizeof(u32));
+                stream.read(reinterpret_cast<char *>(entralinkSize.data()), entralinkSize.size() * sizeof(u32));
+                stream.read(reinterpret_cast<char *>(normalSize.data()), normalSize.size() * sizeof(u32));
+                stream.read(reinterpret_cast<char *>(roamerSize.data()), roamerSize.size() * sizeof(u32));
             }
 
-            normalSeeds.resize(normalCount.size());
-            for (int i = 0; i < normalCount.size(); i++)
+            auto readSeeds = [&stream, compressed](std::vector<IVCacheSeeds> &seeds, const std::vector<u32> &counts,
+                                                   const std::vector<u32> &sizes) {
+                seeds.resize(counts.size());
+                for (int i = 0; i < counts.size(); i++)
+                {
+                    seeds[i].count = counts[i];
+                    if (compressed)
+                    {
+                        seeds[i].compressed.resize(sizes[i]);
+                        stream.read(reinterpret_cast<char *>(seeds[i].compressed.data()), sizes[i]);
+                    }
+                    else
+                    {
+                        seeds[i].seeds.resize(counts[i]);
+                        stream.read(reinterpret_cast<char *>(seeds[i].seeds.data()), counts[i] * sizeof(u32));
+                    }
+                }
+            };
+
+            readSeeds(entralinkSeeds, entralinkCount, entralinkSize);
+            readSeeds(normalSeeds, normalCount, normalSize);
+            readSeeds(roamerSeeds, roamerCount, roamerSize);
+            if (!stream)
             {
-                normalSeeds[i].resize(normalCount[i]);
-                stream.read(reinterpret_cast<char *>(normalSeeds[i].data()), normalCount[i] * sizeof(u32));
+                return;
             }
 
-            roamerSeeds.resize(roamerCount.size());
-            for (int i = 0; i < roamerCount.size(); i++)
+            // Compressed seeds are only decompressed when they are used, so only their frame sizes are checked here
+            for (const auto *list : { &entralinkSeeds, &normalSeeds, &roamerSeeds })
             {
-                roamerSeeds[i].resize(roamerCount[i]);
-                stream.read(reinterpret_cast<char *>(roamerSeeds[i].data()), roamerCount[i] * sizeof(u32));
+                for (const auto &seeds : *list)
+                {
+                    if (compressed && !Utilities::validateValues<u32>(seeds.compressed.data(), seeds.compressed.size(), seeds.count))
+                    {
+                        return;
+                    }
+                }
             }
         }
+        else if (!stream)
+        {
+            return;
+        }
 
         valid = true;
     }
@@ -155,29 +204,37 @@ fph::MetaFphMap<u64, std::array<u8, 6>> IVCache::getCache(u32 initialAdvances, u
 
 std::vector<u32> IVCache::getSeeds(Game version, CacheType type) const
 {
-    std::vector<u32> seeds;
+    const std::vector<IVCacheSeeds> *list;
+    int start = 0;
+    int end;
     if (type == CacheType::Entralink)
     {
-        for (int i = 0; i < entralinkSeeds.size(); i++)
-        {
-            seeds.insert(seeds.end(), entralinkSeeds[i].begin(), entralinkSeeds[i].end());
-        }
+        list = &entralinkSeeds;
+        end = entralinkSeeds.size();
     }
     else if (type == CacheType::Normal)
     {
-        int start = (version & Game::BW) != Game::None ? 0 : 2;
-        int end = (version & Game::BW) != Game::None ? normalSeeds.size() - 2 : normalSeeds.size();
-        for (int i = start; i < end; i++)
-        {
-            seeds.insert(seeds.end(), normalSeeds[i].begin(), normalSeeds[i].end());
-        }
+        list = &normalSeeds;
+        start = (version & Game::BW) != Game::None ? 0 : 2;
+        end = (version & Game::BW) != Game::None ? normalSeeds.size() - 2 : normalSeeds.size();
     }
     else
     {
-        for (int i = 0; i < roamerSeeds.size(); i++)
+        list = &roamerSeeds;
+        end = roamerSeeds.size();
+    }
+
+    std::vector<u32> seeds;
+    std::vector<u32> buffer;
+    for (int i = start; i < end; i++)
+    {
+        const std::vector<u32> *advance = (*list)[i].getSeeds(buffer);
+        if (!advance)
         {
-            seeds.insert(seeds.end(), roamerSeeds[i].begin(), roamerSeeds[i].end());
+            valid = false;
+            return {};
         }
+        seeds.insert(seeds.end(), advance->begin(), advance->end());
     }
 
     std::ranges::sort(seeds);
@@ -194,10 +251,18 @@ bool IVCache::isValid() const
 fph::MetaFphMap<u64, std::array<u8, 6>> IVCache::getEntralinkCache(u32 initialAdvances, u32 maxAdvances, const StateFilter &filter) const
 {
     fph::MetaFphMap<u64, std::array<u8, 6>> cache;
+    std::vector<u32> buffer;
 
     for (u64 i = initialAdvances; i <= (initialAdvances + maxAdvances) && i < entralinkSeeds.size(); i++)
     {
-        for (u32 seed : entralinkSeeds[i])
+        const std::vector<u32> *seeds = entralinkSeeds[i].getSeeds(buffer);
+        if (!seeds)
+        {
+            valid = false;
+            return {};
+        }
+
+        for (u32 seed : *seeds)
         {
             auto ivs = computeIVs(seed, i, CacheType::Entralink);
             if (compareIVs(ivs, filter))
@@ -217,11 +282,19 @@ fph::MetaFphMap<u64, std::array<u8, 6>> IVCache::getNormalCache(u32 initialAdvan
                                                                 const StateFilter &filter) const
 {
     fph::MetaFphMap<u64, std::array<u8, 6>> cache;
+    std::vector<u32> buffer;
 
     bool bw = (version & Game::BW) != Game::None;
     for (u64 i = initialAdvances; i <= (initialAdvances + maxAdvances) && (i + (bw ? 0 : 2)) < normalSeeds.size(); i++)
     {
-        for (u32 seed : normalSeeds[i + (bw ? 0 : 2)])
+        const std::vector<u32> *seeds = normalSeeds[i + (bw ? 0 : 2)].getSeeds(buffer);
+        if (!seeds)
+        {
+            valid = false;
+            return {};
+        }
+
+        for (u32 seed : *seeds)
         {
             auto ivs = computeIVs(seed, i + (bw ? 0 : 2), CacheType::Normal);
             if (compareIVs(ivs, filter))
@@ -240,10 +313,18 @@ fph::MetaFphMap<u64, std::array<u8, 6>> IVCache::getNormalCache(u32 initialAdvan
 fph::MetaFphMap<u64, std::array<u8, 6>> IVCache::getRoamerCache(u32 initialAdvances, u32 maxAdvances, const StateFilter &filter) const
 {
     fph::MetaFphMap<u64, std::array<u8, 6>> cache;
+    std::vector<u32> buffer;
 
     for (u64 i = initialAdvances; i <= (initialAdvances + maxAdvances) && i < roamerSeeds.size(); i++)
     {
-        for (u32 seed : roamerSeeds[i])
+        const std::vector<u32> *seeds = roamerSeeds[i].getSeeds(buffer);
+        if (!seeds)
+        {
+            valid = false;
+            return {};
+        }
+
+        for (u32 seed : *seeds)
         {
             auto ivs = computeIVs(seed, i, CacheType::Roamer);
             if (compareIVs(ivs, filter))
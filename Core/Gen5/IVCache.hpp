@@ -35,6 +35,25 @@ enum class CacheType : u8
     Roamer
 };
 
+/**
+ * @brief Seeds of a single IV advance. Seeds read from a compressed cache stay compressed until they are requested.
+ */
+struct IVCacheSeeds
+{
+    std::vector<u32> seeds;
+    std::vector<u8> compressed;
+    u32 count;
+
+    /**
+     * @brief Returns the seeds. Uncompressed seeds are returned without a copy, compressed seeds are decompressed into \p buffer.
+     *
+     * @param buffer Storage for the decompressed seeds
+     *
+     * @return Sorted seeds, or nullptr if the seeds could not be decompressed
+     */
+    const std::vector<u32> *getSeeds(std::vector<u32> &buffer) const;
+};
+
 /**
  * @brief Cache for IV seeds
  */
@@ -94,17 +113,17 @@ public:
     std::vector<u32> getSeeds(Game version, CacheType type) const;
 
     /**
-     * @brief Determines if cache is valid
+     * @brief Determines if cache is valid. A cache whose seeds can not be read or decompressed is invalid.
      */
     bool isValid() const;
 
 private:
-    std::vector<std::vector<u32>> entralinkSeeds;
-    std::vector<std::vector<u32>> normalSeeds;
-    std::vector<std::vector<u32>> roamerSeeds;
+    std::vector<IVCacheSeeds> entralinkSeeds;
+    std::vector<IVCacheSeeds> normalSeeds;
+    std::vector<IVCacheSeeds> roamerSeeds;
     u32 initialAdvances;
     u32 maxAdvances;
-    bool valid;
+    mutable bool valid;
 
     /**
      * @brief Returns the IV caches for entralink
@@ -22,18 +22,28 @@
 #include <Core/Enum/Game.hpp>
 #include <Core/Gen5/Keypresses.hpp>
 #include <Core/Util/DateTime.hpp>
+#include <Core/Util/Utilities.hpp>
+#include <algorithm>
+#include <cstring>
 
 constexpr u32 DATA_OFFSET = 42;
 
+// Expected magic word is CRC32 of "SHA1Cache"
+constexpr u32 MAGIC_V1 = 0x3c50a97e;
+
+// Expected magic word is CRC32 of "SHA1CacheV2"
+constexpr u32 MAGIC_V2 = 0x7b59cac9;
+
 SHA1Cache::SHA1Cache(std::string_view path) : file(path.data(), std::ios_base::in | std::ios_base::binary), valid(false)
 {
     if (file.is_open())
     {
         u32 magic;
-
-        // Expected magic word is CRC32 of "SHA1Cache"
         file.read(reinterpret_cast<char *>(&magic), sizeof(magic));
-        if (magic != 0x3c50a97e)
+
+        // Caches written before the date index are still read, without converting them
+        indexed = magic == MAGIC_V2;
+        if (magic != MAGIC_V1 && !indexed)
         {
             return;
         }
@@ -46,14 +56,22 @@ SHA1Cache::SHA1Cache(std::string_view path) : file(path.data(), std::ios_base::i
         file.read(reinterpret_cast<char *>(&version), sizeof(version));
         file.read(reinterpret_cast<char *>(&timer0max), sizeof(timer0max));
         file.read(reinterpret_cast<char *>(&timer0min), sizeof(timer0min));
-        file.seekg(1, std::ios_base::cur);
+        if (indexed)
+        {
+            file.read(reinterpret_cast<char *>(&compressed), sizeof(compressed));
+        }
+        else
+        {
+            file.seekg(1, std::ios_base::cur);
+            compressed = false;
+        }
         file.read(reinterpret_cast<char *>(&type), sizeof(type));
         file.read(reinterpret_cast<char *>(&language), sizeof(language));
         file.read(reinterpret_cast<char *>(&gxstat), sizeof(gxstat));
         file.read(reinterpret_cast<char *>(&vcount), sizeof(vcount));
         file.read(reinterpret_cast<char *>(&vframe), sizeof(vframe));
 
-        valid = true;
+        valid = static_cast<bool>(file);
     }
 }
 
@@ -67,48 +85,164 @@ fph::MetaFphMap<u64, u64> SHA1Cache::getCache(u32 initialAdvance, u32 maxAdvance
                                               const Profile5 &profile)
 {
     fph::MetaFphMap<u64, u64> cache;
-    auto keypresses = Keypresses::getKeypresses(profile);
 
-    u32 countEntralink;
-    u32 countNormal;
-    u32 countRoamer;
+    // Clamp the requested dates to the dates stored in the cache
+    Date first = std::max(start, this->start);
+    Date last = std::min(end, this->end);
+    if (first > last)
+    {
+        return cache;
+    }
+
+    std::array<bool, 4096> buttons {};
+    for (const auto &keypress : Keypresses::getKeypresses(profile))
+    {
+        buttons[toInt(keypress.button)] = true;
+    }
+
+    auto add = [&](const SHA1Key &key, u64 seed) {
+        if (buttons[key.button])
+        {
+            for (u64 i = initialAdvance; i <= (initialAdvance + maxAdvance); i++)
+            {
+                if (ivCache.contains((i << 32) | (seed >> 32)))
+                {
+                    cache.emplace(key.key, seed);
+                    break;
+                }
+            }
+        }
+    };
 
+    std::array<u32, 3> counts;
     file.seekg(DATA_OFFSET);
-    file.read(reinterpret_cast<char *>(&countEntralink), sizeof(countEntralink));
-    file.read(reinterpret_cast<char *>(&countNormal), sizeof(countNormal));
-    file.read(reinterpret_cast<char *>(&countRoamer), sizeof(countRoamer));
+    file.read(reinterpret_cast<char *>(counts.data()), sizeof(counts));
+
+    u32 days = this->start.daysTo(this->end) + 1;
+    u32 section = static_cast<u32>(type);
 
-    u32 count;
-    if (type == CacheType::Entralink)
+    if (!indexed)
     {
-        count = countEntralink;
+        // Sections without a date index are not sorted, so every record of the section is checked
+        u64 records = DATA_OFFSET + sizeof(counts);
+        for (u32 i = 0; i < section; i++)
+        {
+            records += counts[i] * sizeof(SHA1Seed);
+        }
+
+        u16 firstDay = first.getJD() - Date().getJD();
+        u16 lastDay = last.getJD() - Date().getJD();
+        u32 count = counts[section];
+
+        std::vector<SHA1Seed> entries(std::min(count, 0x10000u));
+        file.seekg(records);
+        for (u32 i = 0; i < count; i += entries.size())
+        {
+            u32 size = std::min<u32>(entries.size(), count - i);
+            file.read(reinterpret_cast<char *>(entries.data()), size * sizeof(SHA1Seed));
+
+            for (u32 j = 0; j < size; j++)
+            {
+                if (entries[j].key.date >= firstDay && entries[j].key.date <= lastDay)
+                {
+                    add(entries[j].key, entries[j].seed);
+                }
+            }
+        }
     }
-    else if (type == CacheType::Normal)
+    else if (compressed)
     {
-        file.seekg(countEntralink * sizeof(SHA1Seed), std::ios_base::cur);
-        count = countNormal;
+        // The day table gives the file position of each day's compressed block
+        std::vector<u64> offsets(first.daysTo(last) + 2);
+        file.seekg(DATA_OFFSET + sizeof(counts) + (section * (days + 1) + this->start.daysTo(first)) * sizeof(u64));
+        file.read(reinterpret_cast<char *>(offsets.data()), offsets.size() * sizeof(u64));
+
+        file.seekg(0, std::ios_base::end);
+        u64 size = file.tellg();
+        if (!file || !std::ranges::is_sorted(offsets) || offsets.back() > size)
+        {
+            valid = false;
+            return {};
+        }
+
+        std::vector<u8> block;
+        std::vector<u64> keys;
+        std::vector<u64> seeds;
+        file.seekg(offsets[0]);
+        for (u32 i = 0; i < offsets.size() - 1; i++)
+        {
+            block.resize(offsets[i + 1] - offsets[i]);
+            if (block.empty())
+            {
+                continue;
+            }
+            file.read(reinterpret_cast<char *>(block.data()), block.size());
+
+            // Check the block header against the block before trusting the sizes it gives
+            u32 count;
+            u32 keySize;
+            constexpr u32 headerSize = sizeof(count) + sizeof(keySize);
+            if (!file || block.size() < headerSize)
+            {
+                valid = false;
+                return {};
+            }
+            std::memcpy(&count, block.data(), sizeof(count));
+            std::memcpy(&keySize, block.data() + sizeof(count), sizeof(keySize));
+
+            const u8 *keyData = block.data() + headerSize;
+            const u8 *seedData = keyData + keySize;
+            if (keySize > block.size() - headerSize || !Utilities::validateValues<u64>(keyData, keySize, count)
+                || !Utilities::validateValues<u64>(seedData, block.size() - headerSize - keySize, count))
+            {
+                valid = false;
+                return {};
+            }
+
+            keys.resize(count);
+            seeds.resize(count);
+            if (!Utilities::decompressValues(keyData, keySize, keys.data(), count, true)
+                || !Utilities::decompressValues(seedData, block.size() - headerSize - keySize, seeds.data(), count, false))
+            {
+                valid = false;
+                return {};
+            }
+
+            for (u32 j = 0; j < count; j++)
+            {
+                SHA1Key key;
+                key.key = keys[j];
+                add(key, seeds[j]);
+            }
+        }
     }
     else
     {
-        file.seekg((countEntralink + countNormal) * sizeof(SHA1Seed), std::ios_base::cur);
-        count = countRoamer;
-    }
+        u64 records = DATA_OFFSET + sizeof(counts) + 3 * (days + 1) * sizeof(u32);
+        for (u32 i = 0; i < section; i++)
+        {
+            records += counts[i] * sizeof(SHA1Seed);
+        }
 
-    for (u32 i = 0; i < count; i++)
-    {
-        SHA1Seed entry;
-        file.read(reinterpret_cast<char *>(&entry), sizeof(entry));
+        // The day table gives the records of the requested dates, which are stored next to each other
+        u32 begin;
+        u32 stop;
+        u64 table = DATA_OFFSET + sizeof(counts) + section * (days + 1) * sizeof(u32);
+        file.seekg(table + this->start.daysTo(first) * sizeof(u32));
+        file.read(reinterpret_cast<char *>(&begin), sizeof(begin));
+        file.seekg(table + (this->start.daysTo(last) + 1) * sizeof(u32));
+        file.read(reinterpret_cast<char *>(&stop), sizeof(stop));
 
-        if (entry.key.date >= (start.getJD() - Date().getJD()) && entry.key.date <= (end.getJD() - Date().getJD())
-            && std::ranges::find_if(keypresses, [&entry](const Keypress keypress) { return entry.key.button == toInt(keypress.button); })
-                != keypresses.end())
+        std::vector<SHA1Seed> entries(std::min(stop - begin, 0x10000u));
+        file.seekg(records + begin * sizeof(SHA1Seed));
+        for (u32 i = begin; i < stop; i += entries.size())
         {
-            for (u64 j = initialAdvance; j <= (initialAdvance + maxAdvance); j++)
+            u32 size = std::min<u32>(entries.size(), stop - i);
+            file.read(reinterpret_cast<char *>(entries.data()), size * sizeof(SHA1Seed));
+
+            for (u32 j = 0; j < size; j++)
             {
-                if (ivCache.contains((j << 32) | (entry.seed >> 32)))
-                {
-                    cache.emplace(entry.key.key, entry.seed);
-                }
+                add(entries[j].key, entries[j].seed);
             }
         }
     }
@@ -129,10 +263,10 @@ bool SHA1Cache::isValid(const Profile5 &profile) const
     std::ifstream stream(profile.getIVCache().data(), std::ios_base::in | std::ios_base::binary);
     if (stream.is_open())
     {
-        // Expected magic word is CRC32 of "IVCache"
+        // Expected magic word is CRC32 of "IVCache" or CRC32 of "IVCacheZstd"
         u32 magic;
         stream.read(reinterpret_cast<char *>(&magic), sizeof(magic));
-        if (magic != 0xd08cb7c0)
+        if (magic != 0xd08cb7c0 && magic != 0x7576fc60)
         {
             return false;
         }
@@ -149,3 +283,111 @@ bool SHA1Cache::isValid(const Profile5 &profile) const
 
     return false;
 }
+
+void SHA1Cache::writeSeeds(std::ofstream &stream, const Date &start, const Date &end, std::vector<SHA1Seed> &entralink,
+                           std::vector<SHA1Seed> &normal, std::vector<SHA1Seed> &roamer, bool compress)
+{
+    u16 offset = start.getJD() - Date().getJD();
+
+    std::array<std::vector<SHA1Seed> *, 3> sections = { &entralink, &normal, &roamer };
+    for (auto *section : sections)
+    {
+        std::ranges::sort(*section, {}, [](const SHA1Seed &seed) { return seed.key.date; });
+    }
+
+    writeSeeds(
+        stream, start, end,
+        [&](u8 section, u32 day) {
+            auto range = std::ranges::equal_range(*sections[section], static_cast<u16>(offset + day), {},
+                                                  [](const SHA1Seed &seed) { return seed.key.date; });
+            return std::vector<SHA1Seed>(range.begin(), range.end());
+        },
+        compress);
+}
+
+void SHA1Cache::writeSeeds(std::ofstream &stream, const Date &start, const Date &end,
+                           const std::function<std::vector<SHA1Seed>(u8, u32)> &getSeeds, bool compress)
+{
+    u32 days = start.daysTo(end) + 1;
+
+    // The counts and day tables are only known once every day has been written, reserve their space for now
+    u64 header = stream.tellp();
+    std::array<u32, 3> counts {};
+    std::array<std::vector<u64>, 3> tables;
+    std::vector<char> reserved(sizeof(counts) + 3 * (days + 1) * (compress ? sizeof(u64) : sizeof(u32)));
+    stream.write(reserved.data(), reserved.size());
+
+    std::vector<u64> keys;
+    std::vector<u64> seeds;
+    for (u8 section = 0; section < 3; section++)
+    {
+        auto &table = tables[section];
+        table.resize(days + 1);
+        for (u32 day = 0; day < days; day++)
+        {
+            // Uncompressed tables hold the index of the first record of each day, compressed tables the file position of each day's block
+            table[day] = compress ? static_cast<u64>(stream.tellp()) : counts[section];
+
+            auto records = getSeeds(section, day);
+            counts[section] += records.size();
+            if (records.empty())
+            {
+                continue;
+            }
+
+            if (!compress)
+            {
+                std::ranges::sort(records, [](const SHA1Seed &first, const SHA1Seed &second) {
+                    if (first.key.button != second.key.button)
+                    {
+                        return first.key.button < second.key.button;
+                    }
+
+                    return first.key.key < second.key.key;
+                });
+                stream.write(reinterpret_cast<const char *>(records.data()), records.size() * sizeof(SHA1Seed));
+                continue;
+            }
+
+            // Each day is compressed as a separate block so readers only decompress the dates they need.
+            // The keys of a block are sorted so they can be delta encoded, the seeds are stored as is.
+            std::ranges::sort(records, [](const SHA1Seed &first, const SHA1Seed &second) { return first.key.key < second.key.key; });
+
+            u32 count = records.size();
+            keys.resize(count);
+            seeds.resize(count);
+            for (u32 i = 0; i < count; i++)
+            {
+                keys[i] = records[i].key.key;
+                seeds[i] = records[i].seed;
+            }
+
+            auto keyData = Utilities::compressValues(keys.data(), count, true);
+            auto seedData = Utilities::compressValues(seeds.data(), count, false);
+            u32 keySize = keyData.size();
+
+            stream.write(reinterpret_cast<const char *>(&count), sizeof(count));
+            stream.write(reinterpret_cast<const char *>(&keySize), sizeof(keySize));
+            stream.write(reinterpret_cast<const char *>(keyData.data()), keyData.size());
+            stream.write(reinterpret_cast<const char *>(seedData.data()), seedData.size());
+        }
+        table[days] = compress ? static_cast<u64>(stream.tellp()) : counts[section];
+    }
+
+    u64 position = stream.tellp();
+    stream.seekp(header);
+    stream.write(reinterpret_cast<const char *>(counts.data()), sizeof(counts));
+    for (const auto &table : tables)
+    {
+        if (compress)
+        {
+            stream.write(reinterpret_cast<const char *>(table.data()), table.size() * sizeof(u64));
+        }
+        else
+        {
+            std::vector<u32> indexes(table.begin(), table.end());
+            stream.write(reinterpret_cast<const char *>(indexes.data()), indexes.size() * sizeof(u32));
+        }
+    }
+    stream.seekp(position);
+}
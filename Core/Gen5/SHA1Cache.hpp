@@ -25,6 +25,7 @@
 #include <Core/Util/DateTime.hpp>
 #include <fph/meta_fph_table.h>
 #include <fstream>
+#include <functional>
 
 enum class DSType : u8;
 enum class Game : u32;
@@ -134,7 +135,7 @@ public:
     }
 
     /**
-     * @brief Determines if cache is valid
+     * @brief Determines if cache is valid. A cache whose seeds can not be read or decompressed is invalid.
      */
     bool isValid() const;
 
@@ -145,6 +146,33 @@ public:
      */
     bool isValid(const Profile5 &profile) const;
 
+    /**
+     * @brief Writes the seed sections of a cache file. Each section is sorted by date and button, and a table of the first record
+     * of each day from \p start to \p end is written before the seeds so readers only load the dates they need.
+     *
+     * @param stream Stream to write to
+     * @param start Start date
+     * @param end End date
+     * @param entralink Entralink seeds
+     * @param normal Normal seeds
+     * @param roamer Roamer seeds
+     * @param compress Whether to compress each day of seeds as a separate zstd block
+     */
+    static void writeSeeds(std::ofstream &stream, const Date &start, const Date &end, std::vector<SHA1Seed> &entralink,
+                           std::vector<SHA1Seed> &normal, std::vector<SHA1Seed> &roamer, bool compress = false);
+
+    /**
+     * @brief Writes the seed sections of a cache file one day at a time, so only a single day of seeds has to be held in memory
+     *
+     * @param stream Stream to write to
+     * @param start Start date
+     * @param end End date
+     * @param getSeeds Returns the seeds of a section and a day offset from \p start, in any order
+     * @param compress Whether to compress each day of seeds as a separate zstd block
+     */
+    static void writeSeeds(std::ofstream &stream, const Date &start, const Date &end,
+                           const std::function<std::vector<SHA1Seed>(u8, u32)> &getSeeds, bool compress);
+
 private:
     std::ifstream file;
     u64 mac;
@@ -155,6 +183,8 @@ private:
     u32 maxAdvances;
     u16 timer0max;
     u16 timer0min;
+    bool compressed;
+    bool indexed;
     DSType type;
     Language language;
     bool valid;
@@ -0,0 +1,76 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "EggSearcher5.hpp"
+
+template <class SHA>
+void EggSearcher5::search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<EggState5>> &buffer)
+{
+    SHA sha(profile);
+    sha.setTimer0(timer0, profile.getVCount());
+    sha.setDate(date);
+    auto alpha = sha.precompute();
+    sha.setButton(keypress.value);
+
+    constexpr u8 lanes = sizeof(alpha[0]) / sizeof(u32);
+    std::array<std::vector<EggState5>, lanes> states;
+
+    for (u32 time = 0; time < 86400; time += lanes)
+    {
+        if (!searching)
+        {
+            return;
+        }
+
+        sha.setTime(time, profile.getDSType());
+        auto seeds = sha.hashSeed(alpha);
+        generator.generate(seeds.data(), lanes, states.data());
+
+        for (u8 i = 0; i < lanes; i++)
+        {
+            if (!states[i].empty())
+            {
+                DateTime dt(date, time + i);
+                for (const auto &state : states[i])
+                {
+                    buffer.emplace_back(dt, seeds[i], keypress.button, timer0, state);
+                }
+            }
+        }
+    }
+}
+
+void EggSearcher5::search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<EggState5>> &buffer)
+{
+#ifdef SIMD_X86
+    if (hasAVX512())
+    {
+        search<SHA1AVX512>(timer0, date, keypress, buffer);
+    }
+    else if (hasAVX2())
+    {
+        search<SHA1AVX2>(timer0, date, keypress, buffer);
+    }
+    else
+#endif
+    {
+        search<SHA1SSE>(timer0, date, keypress, buffer);
+    }
+    progress++;
+}
@@ -0,0 +1,68 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef EGGSEARCHER5_HPP
+#define EGGSEARCHER5_HPP
+
+#include <Core/Gen5/Generators/EggGenerator5.hpp>
+#include <Core/Gen5/Searchers/SearcherBase5.hpp>
+#include <Core/Gen5/States/EggState5.hpp>
+#include <Core/Gen5/States/SearcherState5.hpp>
+
+/**
+ * @brief Egg searcher for Gen5
+ */
+class EggSearcher5 : public SearcherBase5<EggGenerator5, EggState5>
+{
+public:
+    /**
+     * @brief Construct a new EggSearcher5 object
+     *
+     * @param generator Egg state generator
+     * @param profile Profile information
+     */
+    EggSearcher5(const EggGenerator5 &generator, const Profile5 &profile) : SearcherBase5(generator, profile)
+    {
+    }
+
+private:
+    /**
+     * @brief Searches a single tile of the search space
+     *
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param buffer Thread local buffer to store results in
+     */
+    void search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<EggState5>> &buffer) override;
+
+    /**
+     * @brief Searches a single tile of the search space with the \p SHA hasher
+     *
+     * @tparam SHA SIMD SHA1 class to hash with
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param buffer Thread local buffer to store results in
+     */
+    template <class SHA>
+    void search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<EggState5>> &buffer);
+};
+
+#endif // EGGSEARCHER5_HPP
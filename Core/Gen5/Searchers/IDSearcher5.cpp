@@ -18,11 +18,14 @@
  */
 
 #include "IDSearcher5.hpp"
+#include <Core/Util/Utilities.hpp>
+#include <algorithm>
 
 std::vector<SearcherState5<IDState>> IDSearcher5::search(const IDGenerator5 &generator, const Date &date, u8 hour, u8 minute, u8 minSecond,
                                                          u8 maxSecond)
 {
-    SHA1 sha(profile);
+    SHA1SSE sha(profile);
+    u32 start = hour * 3600 + minute * 60;
 
     for (u16 timer0 = profile.getTimer0Min(); timer0 <= profile.getTimer0Max(); timer0++)
     {
@@ -33,20 +36,33 @@ std::vector<SearcherState5<IDState>> IDSearcher5::search(const IDGenerator5 &gen
         {
             sha.setButton(keypress.value);
 
-            for (u8 second = minSecond; second <= maxSecond; second++)
+            for (u8 second = minSecond; second <= maxSecond; second += 4)
             {
-                sha.setTime(hour, minute, second, profile.getDSType());
-                u64 seed = sha.hashSeed(alpha);
-
-                auto states = generator.generate(seed);
-                if (!states.empty())
+                std::array<u32, 4> times;
+                for (u8 i = 0; i < 4; i++)
                 {
-                    DateTime dt(date, Time(hour, minute, second));
+                    times[i] = start + std::min<u8>(second + i, maxSecond);
+                }
+
+                sha.setTime(times, profile.getDSType());
+                auto seeds = sha.hashSeed(alpha);
+
+                u8 count = std::min(4, maxSecond - second + 1);
+                std::array<u32, 4> advances;
+                Utilities5::initialAdvancesID(seeds.data(), count, profile.getVersion(), advances.data());
 
-                    results.reserve(results.capacity() + states.size());
-                    for (const auto &state : states)
+                for (u8 i = 0; i < count; i++)
+                {
+                    auto states = generator.generate(seeds[i], advances[i]);
+                    if (!states.empty())
                     {
-                        results.emplace_back(dt, seed, keypress.button, timer0, state);
+                        DateTime dt(date, times[i]);
+
+                        results.reserve(results.capacity() + states.size());
+                        for (const auto &state : states)
+                        {
+                            results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
+                        }
                     }
                 }
             }
@@ -55,3 +71,60 @@ std::vector<SearcherState5<IDState>> IDSearcher5::search(const IDGenerator5 &gen
 
     return results;
 }
+
+template <class SHA>
+void IDSearcher5::search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<IDState>> &buffer)
+{
+    SHA sha(profile);
+    sha.setTimer0(timer0, profile.getVCount());
+    sha.setDate(date);
+    auto alpha = sha.precompute();
+    sha.setButton(keypress.value);
+
+    constexpr u8 lanes = sizeof(alpha[0]) / sizeof(u32);
+    std::array<u32, lanes> advances;
+
+    for (u32 time = 0; time < 86400; time += lanes)
+    {
+        if (!searching)
+        {
+            return;
+        }
+
+        sha.setTime(time, profile.getDSType());
+        auto seeds = sha.hashSeed(alpha);
+        Utilities5::initialAdvancesID(seeds.data(), lanes, profile.getVersion(), advances.data());
+
+        for (u8 i = 0; i < lanes; i++)
+        {
+            auto states = generator.generate(seeds[i], advances[i]);
+            if (!states.empty())
+            {
+                DateTime dt(date, time + i);
+                for (const auto &state : states)
+                {
+                    buffer.emplace_back(dt, seeds[i], keypress.button, timer0, state);
+                }
+            }
+        }
+    }
+}
+
+void IDSearcher5::search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<IDState>> &buffer)
+{
+#ifdef SIMD_X86
+    if (hasAVX512())
+    {
+        search<SHA1AVX512>(timer0, date, keypress, buffer);
+    }
+    else if (hasAVX2())
+    {
+        search<SHA1AVX2>(timer0, date, keypress, buffer);
+    }
+    else
+#endif
+    {
+        search<SHA1SSE>(timer0, date, keypress, buffer);
+    }
+    progress++;
+}
@@ -21,14 +21,14 @@
 #define IDSEARCHER5_HPP
 
 #include <Core/Gen5/Generators/IDGenerator5.hpp>
-#include <Core/Gen5/Searchers/Searcher5.hpp>
+#include <Core/Gen5/Searchers/SearcherBase5.hpp>
 #include <Core/Gen5/States/SearcherState5.hpp>
 #include <Core/Parents/States/IDState.hpp>
 
 /**
  * @brief TID/SID searcher for Gen5
  */
-class IDSearcher5 : public Searcher5<IDGenerator5, IDState>
+class IDSearcher5 : public SearcherBase5<IDGenerator5, IDState>
 {
 public:
     /**
@@ -37,7 +37,7 @@ public:
      * @param generator ID state generator
      * @param profile Profile information
      */
-    IDSearcher5(const IDGenerator5 &generator, const Profile5 &profile) : Searcher5(generator, profile)
+    IDSearcher5(const IDGenerator5 &generator, const Profile5 &profile) : SearcherBase5(generator, profile)
     {
     }
 
@@ -55,6 +55,29 @@ public:
      */
     std::vector<SearcherState5<IDState>> search(const IDGenerator5 &generator, const Date &date, u8 hour, u8 minute, u8 minSecond,
                                                 u8 maxSecond);
+
+private:
+    /**
+     * @brief Searches a single tile of the search space
+     *
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param buffer Thread local buffer to store results in
+     */
+    void search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<IDState>> &buffer) override;
+
+    /**
+     * @brief Searches a single tile of the search space with the \p SHA hasher
+     *
+     * @tparam SHA SIMD SHA1 class to hash with
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param buffer Thread local buffer to store results in
+     */
+    template <class SHA>
+    void search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<IDState>> &buffer);
 };
 
 #endif // IDSEARCHER5_HPP
@@ -18,10 +18,15 @@
  */
 
 #include "IVCacheSearcher.hpp"
+#include <Core/Parents/Searchers/TileScheduler.hpp>
 #include <Core/RNG/MT.hpp>
+#include <Core/RNG/MTFast.hpp>
 #include <Core/RNG/RNGList.hpp>
+#include <Core/Util/Utilities.hpp>
 #include <algorithm>
+#include <filesystem>
 #include <fstream>
+#include <sstream>
 #include <thread>
 
 static u8 gen(MT &rng)
@@ -29,38 +34,84 @@ static u8 gen(MT &rng)
     return rng.next() >> 27;
 }
 
+static bool checkIVs(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe)
+{
+    return hp >= 30 && def >= 30 && spd >= 30 && (atk >= 30 || spa >= 30) && (spe <= 1 || spe >= 30);
+}
+
+static bool checkRoamerIVs(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe)
+{
+    return hp >= 30 && def >= 30 && spd >= 30 && (atk >= 30 || spa >= 30) && spe >= 30;
+}
+
 template <typename Type>
-static void write(std::ofstream &file, Type val)
+static void write(std::ostream &file, Type val)
 {
     file.write(reinterpret_cast<char *>(&val), sizeof(val));
 }
 
-IVCacheSearcher::IVCacheSearcher(u32 initialAdvances, u32 maxAdvances) : SearcherBase<std::vector<u32>>(), initialAdvances(initialAdvances), maxAdvances(maxAdvances)
+static std::string getParameters(u32 initialAdvances, u32 maxAdvances)
+{
+    std::ostringstream stream;
+    write(stream, initialAdvances);
+    write(stream, maxAdvances);
+    return stream.str();
+}
+
+IVCacheSearcher::IVCacheSearcher(u32 initialAdvances, u32 maxAdvances, std::string_view checkpoint) :
+    SearcherBase<std::vector<u32>>(),
+    checkpoint(checkpoint, getParameters(initialAdvances, maxAdvances), 0x10000, 3 * maxAdvances + 9, sizeof(u32)),
+    initialAdvances(initialAdvances),
+    maxAdvances(maxAdvances)
 {
-    entralink.resize(maxAdvances + 5);
-    results.resize(maxAdvances + 3);
-    roamer.resize(maxAdvances + 1);
 }
 
 void IVCacheSearcher::startSearch(int threads)
 {
     this->searching = true;
 
+    // Split the seed space into 65536 tiles of 65536 seeds
+    TileScheduler scheduler(0x10000, threads);
     auto *threadContainer = new std::thread[threads];
 
-    u32 split = 0x100000000 / threads;
-    u32 start = 0;
-
-    for (int i = 0; i < threads; i++, start += split)
+    for (int i = 0; i < threads; i++)
     {
-        if (i == threads - 1)
-        {
-            threadContainer[i] = std::thread([=] { search(start, 0xffffffff); });
-        }
-        else
-        {
-            threadContainer[i] = std::thread([=] { search(start, start + split); });
-        }
+        threadContainer[i] = std::thread([this, &scheduler, i] {
+            u64 tile;
+            while (searching && scheduler.next(i, tile))
+            {
+                // Tiles finished by an earlier run of the search are already stored in the checkpoint
+                if (checkpoint.isComplete(tile))
+                {
+                    progress += 0x10000;
+                    continue;
+                }
+
+                std::vector<std::vector<u32>> entralink(maxAdvances + 5);
+                std::vector<std::vector<u32>> normal(maxAdvances + 3);
+                std::vector<std::vector<u32>> roamer(maxAdvances + 1);
+
+                u32 start = tile << 16;
+                search(start, start + 0xffff, entralink, normal, roamer);
+
+                if (searching)
+                {
+                    std::vector<const std::vector<u32> *> lists;
+                    for (const auto *seeds : { &entralink, &normal, &roamer })
+                    {
+                        for (const auto &list : *seeds)
+                        {
+                            lists.emplace_back(&list);
+                        }
+                    }
+                    // Stop the search if the tile could not be stored, the cache would be missing its results otherwise
+                    if (!checkpoint.write(tile, lists))
+                    {
+                        searching = false;
+                    }
+                }
+            }
+        });
     }
 
     for (int i = 0; i < threads; i++)
@@ -71,57 +122,165 @@ void IVCacheSearcher::startSearch(int threads)
     delete[] threadContainer;
 }
 
-void IVCacheSearcher::writeResults(std::string_view file)
+bool IVCacheSearcher::failed() const
+{
+    return checkpoint.failed();
+}
+
+bool IVCacheSearcher::writeResults(std::string_view file, bool compress)
 {
     std::ofstream stream(file.data(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
-    if (stream.is_open())
+    if (!stream.is_open())
     {
-        // Write magic identifier: CRC32 of "IVCache"
-        write(stream, 0xd08cb7c0);
+        return false;
+    }
 
-        // Write cache advances
-        write(stream, initialAdvances);
-        write(stream, maxAdvances);
+    // Write magic identifier: CRC32 of "IVCache" or CRC32 of "IVCacheZstd" when compressed
+    write(stream, compress ? 0x7576fc60 : 0xd08cb7c0);
 
-        // Write seed sizes
-        for (int i = 0; i < entralink.size(); i++)
+    // Write cache advances
+    write(stream, initialAdvances);
+    write(stream, maxAdvances);
+
+    // Write seed sizes
+    u32 lists = 3 * maxAdvances + 9;
+    for (u32 i = 0; i < lists; i++)
+    {
+        write<u32>(stream, checkpoint.getTotal(i));
+    }
+
+    // Tiles cover increasing seed ranges, so joining the tiles in order gives each list sorted without merging in memory
+    auto writeSeeds = [this, lists](std::ostream &out) {
+        std::vector<u64> positions(lists);
+        u64 position = out.tellp();
+        for (u32 i = 0; i < lists; i++)
         {
-            std::ranges::sort(entralink[i]);
-            write<u32>(stream, entralink[i].size());
+            positions[i] = position;
+            position += checkpoint.getTotal(i) * sizeof(u32);
         }
 
-        for (int i = 0; i < results.size(); i++)
+        std::vector<std::vector<u32>> seeds;
+        for (u64 tile = 0; tile < 0x10000; tile++)
         {
-            std::ranges::sort(results[i]);
-            write<u32>(stream, results[i].size());
+            if (!checkpoint.read(tile, seeds))
+            {
+                return false;
+            }
+
+            for (u32 i = 0; i < seeds.size(); i++)
+            {
+                if (!seeds[i].empty())
+                {
+                    out.seekp(positions[i]);
+                    out.write(reinterpret_cast<const char *>(seeds[i].data()), seeds[i].size() * sizeof(u32));
+                    positions[i] += seeds[i].size() * sizeof(u32);
+                }
+            }
         }
+        out.seekp(position);
+        return static_cast<bool>(out);
+    };
 
-        for (int i = 0; i < roamer.size(); i++)
+    if (compress)
+    {
+        // Each advance is compressed separately so readers only decompress the advances they search.
+        // The seeds are joined in a temporary file first so only one advance has to be held in memory.
+        std::string temp = std::string(file) + ".tmp";
+        std::fstream seeds(temp, std::ios_base::in | std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        bool good = writeSeeds(seeds);
+        seeds.seekg(0);
+
+        // Compressed sizes are written once every advance has been compressed
+        u64 position = stream.tellp();
+        std::vector<u32> sizes(lists);
+        stream.write(reinterpret_cast<const char *>(sizes.data()), sizes.size() * sizeof(u32));
+
+        std::vector<u32> list;
+        for (u32 i = 0; good && i < lists; i++)
         {
-            std::ranges::sort(roamer[i]);
-            write<u32>(stream, roamer[i].size());
+            list.resize(checkpoint.getTotal(i));
+            seeds.read(reinterpret_cast<char *>(list.data()), list.size() * sizeof(u32));
+            if (!seeds)
+            {
+                good = false;
+                continue;
+            }
+
+            auto data = Utilities::compressValues(list.data(), list.size(), true);
+            stream.write(reinterpret_cast<const char *>(data.data()), data.size());
+            sizes[i] = data.size();
         }
 
-        // Write seeds
-        for (int i = 0; i < entralink.size(); i++)
+        stream.seekp(position);
+        stream.write(reinterpret_cast<const char *>(sizes.data()), sizes.size() * sizeof(u32));
+
+        seeds.close();
+        std::filesystem::remove(temp);
+        if (!good)
         {
-            stream.write(reinterpret_cast<char *>(entralink[i].data()), entralink[i].size() * sizeof(u32));
+            stream.setstate(std::ios_base::failbit);
         }
+    }
+    else if (!writeSeeds(stream))
+    {
+        stream.setstate(std::ios_base::failbit);
+    }
+
+    stream.close();
+    if (!stream)
+    {
+        // Keep the checkpoint so the cache can be written again, and do not leave an incomplete cache behind
+        std::error_code error;
+        std::filesystem::remove(file, error);
+        return false;
+    }
 
-        for (int i = 0; i < results.size(); i++)
+    checkpoint.remove();
+    return true;
+}
+
+void IVCacheSearcher::search(u32 start, u32 end, std::vector<std::vector<u32>> &entralink, std::vector<std::vector<u32>> &normal,
+                             std::vector<std::vector<u32>> &roamer)
+{
+    // The last entralink IV of the last advance is the furthest MT value needed
+    u32 size = initialAdvances + maxAdvances + 32;
+#ifdef SIMD_X86
+    if (hasAVX2())
+    {
+        if (size <= 64)
         {
-            stream.write(reinterpret_cast<char *>(results[i].data()), results[i].size() * sizeof(u32));
+            search<64, vuint256>(start, end, entralink, normal, roamer);
+            return;
         }
-
-        for (int i = 0; i < roamer.size(); i++)
+        else if (size <= 128)
         {
-            stream.write(reinterpret_cast<char *>(roamer[i].data()), roamer[i].size() * sizeof(u32));
+            search<128, vuint256>(start, end, entralink, normal, roamer);
+            return;
+        }
+        else if (size <= 226)
+        {
+            search<226, vuint256>(start, end, entralink, normal, roamer);
+            return;
         }
     }
-}
+#endif
+
+    if (size <= 64)
+    {
+        search<64, vuint128>(start, end, entralink, normal, roamer);
+        return;
+    }
+    else if (size <= 128)
+    {
+        search<128, vuint128>(start, end, entralink, normal, roamer);
+        return;
+    }
+    else if (size <= 226)
+    {
+        search<226, vuint128>(start, end, entralink, normal, roamer);
+        return;
+    }
 
-void IVCacheSearcher::search(u32 start, u32 end)
-{
     for (u32 seed = start;; seed++)
     {
         if (!searching)
@@ -140,9 +299,8 @@ void IVCacheSearcher::search(u32 start, u32 end)
             u8 spa = rngList.next();
             u8 spd = rngList.next();
             u8 spe = rngList.next();
-            if (hp >= 30 && def >= 30 && spd >= 30 && (atk >= 30 || spa >= 30) && (spe <= 1 || spe >= 30))
+            if (checkIVs(hp, atk, def, spa, spd, spe))
             {
-                std::lock_guard<std::mutex> lock(mutex);
                 entralink[i].emplace_back(seed);
             }
 
@@ -158,10 +316,9 @@ void IVCacheSearcher::search(u32 start, u32 end)
                 spd = rngList.next();
                 spe = rngList.next();
 
-                if (hp >= 30 && def >= 30 && spd >= 30 && (atk >= 30 || spa >= 30) && (spe <= 1 || spe >= 30))
+                if (checkIVs(hp, atk, def, spa, spd, spe))
                 {
-                    std::lock_guard<std::mutex> lock(mutex);
-                    results[i].emplace_back(seed);
+                    normal[i].emplace_back(seed);
                 }
             }
 
@@ -178,9 +335,8 @@ void IVCacheSearcher::search(u32 start, u32 end)
                 spe = rngList.next();
                 spa = rngList.next();
 
-                if (hp >= 30 && def >= 30 && spd >= 30 && (atk >= 30 || spa >= 30) && spe >= 30)
+                if (checkRoamerIVs(hp, atk, def, spa, spd, spe))
                 {
-                    std::lock_guard<std::mutex> lock(mutex);
                     roamer[i].emplace_back(seed);
                 }
             }
@@ -193,3 +349,65 @@ void IVCacheSearcher::search(u32 start, u32 end)
         }
     }
 }
+
+template <u16 size, class Vector>
+void IVCacheSearcher::search(u32 start, u32 end, std::vector<std::vector<u32>> &entralink, std::vector<std::vector<u32>> &normal,
+                             std::vector<std::vector<u32>> &roamer)
+{
+    constexpr u32 lanes = sizeof(Vector) / sizeof(u32);
+
+    std::array<std::array<u8, lanes>, size> ivs;
+    u32 count = maxAdvances + 32;
+    for (u64 seed = start; seed <= end; seed += lanes)
+    {
+        if (!searching)
+        {
+            return;
+        }
+
+        Vector seeds;
+        for (u32 j = 0; j < lanes; j++)
+        {
+            seeds.uint32[j] = seed + j;
+        }
+
+        // Only computes the top 5 bits of each MT value which are the IVs
+        MTFastMulti<size, true, Vector> mt(seeds, initialAdvances);
+        for (u32 i = 0; i < count; i++)
+        {
+            Vector values = mt.next();
+            for (u32 j = 0; j < lanes; j++)
+            {
+                ivs[i][j] = values.uint32[j];
+            }
+        }
+
+        u32 valid = std::min<u64>(lanes, end - seed + 1);
+        for (u32 j = 0; j < valid; j++)
+        {
+            for (u32 i = 0; i <= maxAdvances + 4; i++)
+            {
+                // Entralink
+                if (checkIVs(ivs[i + 22][j], ivs[i + 23][j], ivs[i + 24][j], ivs[i + 25][j], ivs[i + 26][j], ivs[i + 27][j]))
+                {
+                    entralink[i].emplace_back(seed + j);
+                }
+
+                // Normal
+                if (i <= maxAdvances + 2 && checkIVs(ivs[i][j], ivs[i + 1][j], ivs[i + 2][j], ivs[i + 3][j], ivs[i + 4][j], ivs[i + 5][j]))
+                {
+                    normal[i].emplace_back(seed + j);
+                }
+
+                // Roamer
+                if (i <= maxAdvances
+                    && checkRoamerIVs(ivs[i + 1][j], ivs[i + 2][j], ivs[i + 3][j], ivs[i + 6][j], ivs[i + 4][j], ivs[i + 5][j]))
+                {
+                    roamer[i].emplace_back(seed + j);
+                }
+            }
+        }
+
+        progress += valid;
+    }
+}
@@ -20,6 +20,7 @@
 #ifndef IVCACHESEARCHER_HPP
 #define IVCACHESEARCHER_HPP
 
+#include <Core/Parents/Searchers/SearchCheckpoint.hpp>
 #include <Core/Parents/Searchers/SearcherBase.hpp>
 #include <string>
 
@@ -34,8 +35,17 @@ public:
      *
      * @param initialAdvances
      * @param maxAdvances Maximum number of advances
+     * @param checkpoint Path of the checkpoint file, the search continues from it if it already exists
      */
-    IVCacheSearcher(u32 initialAdvances, u32 maxAdvances);
+    IVCacheSearcher(u32 initialAdvances, u32 maxAdvances, std::string_view checkpoint);
+
+    /**
+     * @brief Returns if storing or reading the results in the checkpoint failed. The search stops when a result could not be stored.
+     *
+     * @return true Checkpoint failed
+     * @return false Checkpoint is fine
+     */
+    bool failed() const;
 
     /**
      * @brief Starts the search
@@ -47,15 +57,18 @@ public:
     void startSearch(int threads);
 
     /**
-     * @brief Writes cache results to file
+     * @brief Writes cache results to file and removes the checkpoint
      *
      * @param file Path to write files too
+     * @param compress Whether to compress the seeds
+     *
+     * @return true Cache was written
+     * @return false Writing the cache or reading the checkpoint failed, the checkpoint is kept
      */
-    void writeResults(std::string_view file);
+    bool writeResults(std::string_view file, bool compress = false);
 
 private:
-    std::vector<std::vector<u32>> entralink;
-    std::vector<std::vector<u32>> roamer;
+    SearchCheckpoint checkpoint;
     u32 initialAdvances;
     u32 maxAdvances;
 
@@ -64,8 +77,27 @@ private:
      *
      * @param start Start seed
      * @param end End seed
+     * @param entralink Entralink seeds of each advance
+     * @param normal Normal seeds of each advance
+     * @param roamer Roamer seeds of each advance
+     */
+    void search(u32 start, u32 end, std::vector<std::vector<u32>> &entralink, std::vector<std::vector<u32>> &normal,
+                std::vector<std::vector<u32>> &roamer);
+
+    /**
+     * @brief Searches between the \p start and \p end seeds, computing the IVs of one seed per 32bit lane of \p Vector
+     *
+     * @tparam size Number of MT values to generate
+     * @tparam Vector SIMD vector type
+     * @param start Start seed
+     * @param end End seed
+     * @param entralink Entralink seeds of each advance
+     * @param normal Normal seeds of each advance
+     * @param roamer Roamer seeds of each advance
      */
-    void search(u32 start, u32 end);
+    template <u16 size, class Vector>
+    void search(u32 start, u32 end, std::vector<std::vector<u32>> &entralink, std::vector<std::vector<u32>> &normal,
+                std::vector<std::vector<u32>> &roamer);
 };
 
 #endif // IVCACHESEARCHER_HPP
@@ -21,8 +21,10 @@
 #define IVSEARCHER5_HPP
 
 #include <Core/Enum/Buttons.hpp>
+#include <Core/Gen5/Filters/IVPrefilter5.hpp>
 #include <Core/Gen5/SHA1Cache.hpp>
 #include <Core/Gen5/Searchers/SearcherBase5.hpp>
+#include <Core/Gen5/Searchers/SeedHasher5.hpp>
 #include <fph/meta_fph_table.h>
 
 /**
@@ -44,111 +46,55 @@ public:
      * @param profile Profile information
      */
     IVSearcher5(u32 initialAdvances, u32 maxAdvances, const Generator &generator, const Profile5 &profile) :
-        SearcherBase5<Generator, State>(generator, profile), initialAdvances(initialAdvances), maxAdvances(maxAdvances)
+        SearcherBase5<Generator, State>(generator, profile), prefilter(generator.getIVPrefilter(initialAdvances, maxAdvances))
     {
     }
 
 private:
-    u32 initialAdvances;
-    u32 maxAdvances;
+    IVPrefilter5 prefilter;
 
     /**
-     * @brief Searches between the \p start and \p end dates
+     * @brief Searches a single tile of the search space
      *
-     * @param start Start date
-     * @param end End date
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param buffer Thread local buffer to store results in
      */
-    void search(const Date &start, const Date &end) override
+    void search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<State>> &buffer) override
     {
-#ifdef SIMD_X86
-        if (hasAVX2())
-        {
-            SHA1AVX2 sha(this->profile);
-            for (u16 timer0 = this->profile.getTimer0Min(); timer0 <= this->profile.getTimer0Max(); timer0++)
-            {
-                sha.setTimer0(timer0, this->profile.getVCount());
-                for (Date date = start; date <= end; ++date)
-                {
-                    sha.setDate(date);
-                    auto alpha = sha.precompute();
-                    for (const auto &keypress : this->keypresses)
-                    {
-                        sha.setButton(keypress.value);
-                        for (u32 time = 0; time < 86400; time += 8)
-                        {
-                            if (!this->searching)
-                            {
-                                return;
-                            }
-
-                            sha.setTime(time, this->profile.getDSType());
-                            auto seeds = sha.hashSeed(alpha);
-
-                            for (u32 i = 0; i < seeds.size(); i++)
-                            {
-                                auto states = this->generator.generate(seeds[i], initialAdvances, maxAdvances);
-                                if (!states.empty())
-                                {
-                                    DateTime dt(date, time + i);
+        std::array<std::vector<std::pair<u32, std::array<u8, 6>>>, 16> ivs;
 
-                                    std::lock_guard<std::mutex> lock(this->mutex);
-                                    this->results.reserve(this->results.capacity() + states.size());
-                                    for (const auto &state : states)
-                                    {
-                                        this->results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
-                                    }
-                                }
-                            }
-                        }
-                        this->progress++;
-                    }
-                }
+        bool finished = SeedHasher5::hashDay(this->profile, timer0, date, keypress, [&](u32 time, const u64 *seeds, u8 count) {
+            if (!this->searching)
+            {
+                return false;
             }
-        }
-        else
-#endif
-        {
-            SHA1SSE sha(this->profile);
-            for (u16 timer0 = this->profile.getTimer0Min(); timer0 <= this->profile.getTimer0Max(); timer0++)
+
+            prefilter.filter(seeds, count, ivs.data());
+            for (u8 i = 0; i < count; i++)
             {
-                sha.setTimer0(timer0, this->profile.getVCount());
-                for (Date date = start; date <= end; ++date)
+                if (ivs[i].empty())
                 {
-                    sha.setDate(date);
-                    auto alpha = sha.precompute();
-                    for (const auto &keypress : this->keypresses)
-                    {
-                        sha.setButton(keypress.value);
-                        for (u32 time = 0; time < 86400; time += 4)
-                        {
-                            if (!this->searching)
-                            {
-                                return;
-                            }
-
-                            sha.setTime(time, this->profile.getDSType());
-                            auto seeds = sha.hashSeed(alpha);
-
-                            for (u32 i = 0; i < seeds.size(); i++)
-                            {
-                                auto states = this->generator.generate(seeds[i], initialAdvances, maxAdvances);
-                                if (!states.empty())
-                                {
-                                    DateTime dt(date, time + i);
+                    continue;
+                }
 
-                                    std::lock_guard<std::mutex> lock(this->mutex);
-                                    this->results.reserve(this->results.capacity() + states.size());
-                                    for (const auto &state : states)
-                                    {
-                                        this->results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
-                                    }
-                                }
-                            }
-                        }
-                        this->progress++;
+                auto states = this->generator.generate(seeds[i], ivs[i]);
+                if (!states.empty())
+                {
+                    DateTime dt(date, time + i);
+                    for (const auto &state : states)
+                    {
+                        buffer.emplace_back(dt, seeds[i], keypress.button, timer0, state);
                     }
                 }
             }
+            return true;
+        });
+
+        if (finished)
+        {
+            this->progress++;
         }
     }
 };
@@ -184,120 +130,48 @@ private:
     u32 maxAdvances;
 
     /**
-     * @brief Searches between the \p start and \p end dates
+     * @brief Searches a single tile of the search space
      *
-     * @param start Start date
-     * @param end End date
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param buffer Thread local buffer to store results in
      */
-    void search(const Date &start, const Date &end) override
+    void search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<State>> &buffer) override
     {
-#ifdef SIMD_X86
-        if (hasAVX2())
-        {
-            SHA1AVX2 sha(this->profile);
-            for (u16 timer0 = this->profile.getTimer0Min(); timer0 <= this->profile.getTimer0Max(); timer0++)
+        bool finished = SeedHasher5::hashDay(this->profile, timer0, date, keypress, [&](u32 time, const u64 *seeds, u8 count) {
+            if (!this->searching)
             {
-                sha.setTimer0(timer0, this->profile.getVCount());
-                for (Date date = start; date <= end; ++date)
-                {
-                    sha.setDate(date);
-                    auto alpha = sha.precompute();
-                    for (const auto &keypress : this->keypresses)
-                    {
-                        sha.setButton(keypress.value);
-                        for (u32 time = 0; time < 86400; time += 8)
-                        {
-                            if (!this->searching)
-                            {
-                                return;
-                            }
-
-                            sha.setTime(time, this->profile.getDSType());
-                            auto seeds = sha.hashSeed(alpha);
-
-                            for (u32 i = 0; i < seeds.size(); i++)
-                            {
-                                for (u64 j = initialAdvances; j <= (initialAdvances + maxAdvances); j++)
-                                {
-                                    const auto entry = ivCache.find((j << 32) | (seeds[i] >> 32));
-                                    if (entry == ivCache.end())
-                                    {
-                                        continue;
-                                    }
-
-                                    auto states = this->generator.generate(seeds[i], { { j, entry->second } });
-                                    if (!states.empty())
-                                    {
-                                        DateTime dt(date, time + i);
-
-                                        std::lock_guard<std::mutex> lock(this->mutex);
-                                        this->results.reserve(this->results.capacity() + states.size());
-                                        for (const auto &state : states)
-                                        {
-                                            this->results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                        this->progress++;
-                    }
-                }
+                return false;
             }
-        }
-        else
-#endif
-        {
-            SHA1SSE sha(this->profile);
-            for (u16 timer0 = this->profile.getTimer0Min(); timer0 <= this->profile.getTimer0Max(); timer0++)
+
+            for (u8 i = 0; i < count; i++)
             {
-                sha.setTimer0(timer0, this->profile.getVCount());
-                for (Date date = start; date <= end; ++date)
+                for (u64 j = initialAdvances; j <= (initialAdvances + maxAdvances); j++)
                 {
-                    sha.setDate(date);
-                    auto alpha = sha.precompute();
-                    for (const auto &keypress : this->keypresses)
+                    const auto entry = ivCache.find((j << 32) | (seeds[i] >> 32));
+                    if (entry == ivCache.end())
                     {
-                        sha.setButton(keypress.value);
-                        for (u32 time = 0; time < 86400; time += 4)
-                        {
-                            if (!this->searching)
-                            {
-                                return;
-                            }
-
-                            sha.setTime(time, this->profile.getDSType());
-                            auto seeds = sha.hashSeed(alpha);
-
-                            for (u32 i = 0; i < seeds.size(); i++)
-                            {
-                                for (u64 j = initialAdvances; j <= (initialAdvances + maxAdvances); j++)
-                                {
-                                    const auto entry = ivCache.find((j << 32) | (seeds[i] >> 32));
-                                    if (entry == ivCache.end())
-                                    {
-                                        continue;
-                                    }
-
-                                    auto states = this->generator.generate(seeds[i], { { j, entry->second } });
-                                    if (!states.empty())
-                                    {
-                                        DateTime dt(date, time + i);
+                        continue;
+                    }
 
-                                        std::lock_guard<std::mutex> lock(this->mutex);
-                                        this->results.reserve(this->results.capacity() + states.size());
-                                        for (const auto &state : states)
-                                        {
-                                            this->results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
-                                        }
-                                    }
-                                }
-                            }
+                    auto states = this->generator.generate(seeds[i], { { j, entry->second } });
+                    if (!states.empty())
+                    {
+                        DateTime dt(date, time + i);
+                        for (const auto &state : states)
+                        {
+                            buffer.emplace_back(dt, seeds[i], keypress.button, timer0, state);
                         }
-                        this->progress++;
                     }
                 }
             }
+            return true;
+        });
+
+        if (finished)
+        {
+            this->progress++;
         }
     }
 };
@@ -339,65 +213,55 @@ private:
     u32 maxAdvances;
 
     /**
-     * @brief Searches between the \p start and \p end dates
+     * @brief Searches a single tile of the search space
      *
-     * @param start Start date
-     * @param end End date
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param buffer Thread local buffer to store results in
      */
-    void search(const Date &start, const Date &end) override
+    void search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<State>> &buffer) override
     {
         SHA1Key key;
-        for (u16 timer0 = this->profile.getTimer0Min(); timer0 <= this->profile.getTimer0Max(); timer0++)
+        key.timer0 = timer0;
+        key.date = date.getJD() - Date().getJD();
+        key.button = toInt(keypress.button);
+        for (u32 time = 0; time < 86400; time++)
         {
-            key.timer0 = timer0;
-            for (Date date = start; date <= end; ++date)
+            if (!this->searching)
             {
-                key.date = date.getJD() - Date().getJD();
-                for (const auto &keypress : this->keypresses)
-                {
-                    key.button = toInt(keypress.button);
-                    for (u32 time = 0; time < 86400; time++)
-                    {
-                        if (!this->searching)
-                        {
-                            return;
-                        }
-
-                        key.time = time;
+                return;
+            }
 
-                        const auto sha1Entry = sha1Cache.find(key.key);
-                        if (sha1Entry == sha1Cache.end())
-                        {
-                            continue;
-                        }
+            key.time = time;
 
-                        u64 seed = sha1Entry->second;
-                        for (u64 j = initialAdvances; j <= (initialAdvances + maxAdvances); j++)
-                        {
-                            const auto ivEntry = ivCache.find((j << 32) | (seed >> 32));
-                            if (ivEntry == ivCache.end())
-                            {
-                                continue;
-                            }
+            const auto sha1Entry = sha1Cache.find(key.key);
+            if (sha1Entry == sha1Cache.end())
+            {
+                continue;
+            }
 
-                            auto states = this->generator.generate(seed, { { j, ivEntry->second } });
-                            if (!states.empty())
-                            {
-                                DateTime dt(date, time);
+            u64 seed = sha1Entry->second;
+            for (u64 j = initialAdvances; j <= (initialAdvances + maxAdvances); j++)
+            {
+                const auto ivEntry = ivCache.find((j << 32) | (seed >> 32));
+                if (ivEntry == ivCache.end())
+                {
+                    continue;
+                }
 
-                                std::lock_guard<std::mutex> lock(this->mutex);
-                                this->results.reserve(this->results.capacity() + states.size());
-                                for (const auto &state : states)
-                                {
-                                    this->results.emplace_back(dt, seed, keypress.button, timer0, state);
-                                }
-                            }
-                        }
+                auto states = this->generator.generate(seed, { { j, ivEntry->second } });
+                if (!states.empty())
+                {
+                    DateTime dt(date, time);
+                    for (const auto &state : states)
+                    {
+                        buffer.emplace_back(dt, seed, keypress.button, timer0, state);
                     }
-                    this->progress++;
                 }
             }
         }
+        this->progress++;
     }
 };
 
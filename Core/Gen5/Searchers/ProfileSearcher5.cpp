@@ -24,6 +24,8 @@
 #include <Core/RNG/MTFast.hpp>
 #include <Core/RNG/SHA1.hpp>
 #include <Core/Util/Utilities.hpp>
+#include <algorithm>
+#include <bit>
 #include <thread>
 
 ProfileSearcher5::ProfileSearcher5(const Date &date, const Time &time, u8 minSeconds, u8 maxSeconds, u8 minVCount, u8 maxVCount,
@@ -82,38 +84,85 @@ void ProfileSearcher5::startSearch(int threads, u8 minVFrame, u8 maxVFrame)
 
 void ProfileSearcher5::search(u8 minVFrame, u8 maxVFrame)
 {
-    u8 hour = time.hour();
-    u8 minute = time.minute();
+#ifdef SIMD_X86
+    if (hasAVX512())
+    {
+        searchLanes<SHA1AVX512, 16>(minVFrame, maxVFrame);
+    }
+    else if (hasAVX2())
+    {
+        searchLanes<SHA1AVX2, 8>(minVFrame, maxVFrame);
+    }
+    else
+#endif
+    {
+        searchLanes<SHA1SSE, 4>(minVFrame, maxVFrame);
+    }
+}
+
+template <class SHA, int lanes>
+void ProfileSearcher5::searchLanes(u8 minVFrame, u8 maxVFrame)
+{
+    u32 start = time.hour() * 3600 + time.minute() * 60;
+
+    std::array<u8, lanes> vcounts;
+    std::array<u8, lanes> seconds;
+    std::array<u32, lanes> times;
 
     for (u16 vframe = minVFrame; vframe <= maxVFrame; vframe++)
     {
         for (u16 gxStat = minGxStat; gxStat <= maxGxStat; gxStat++)
         {
-            SHA1 sha(version, language, dsType, mac, vframe, gxStat);
+            SHA sha(version, language, dsType, mac, vframe, gxStat);
             sha.setDate(date);
             sha.setButton(keypress.value);
             for (u32 timer0 = minTimer0; timer0 <= maxTimer0; timer0++)
             {
-                for (u16 vcount = minVCount; vcount <= maxVCount; vcount++)
+                u16 vcount = minVCount;
+                u8 second = minSeconds;
+                while (vcount <= maxVCount)
                 {
-                    sha.setTimer0(timer0, vcount);
-                    auto alpha = sha.precompute();
-                    for (u8 second = minSeconds; second <= maxSeconds; second++)
+                    if (!searching)
+                    {
+                        return;
+                    }
+
+                    // Fill each lane with the next VCount/second combination
+                    u8 count = 0;
+                    for (; count < lanes && vcount <= maxVCount; count++)
                     {
-                        if (!searching)
+                        vcounts[count] = vcount;
+                        seconds[count] = second;
+                        times[count] = start + second;
+                        if (second++ == maxSeconds)
                         {
-                            return;
+                            second = minSeconds;
+                            vcount++;
                         }
+                    }
 
-                        sha.setTime(hour, minute, second, dsType);
+                    // Repeat the last combination in unused lanes
+                    for (u8 i = count; i < lanes; i++)
+                    {
+                        vcounts[i] = vcounts[count - 1];
+                        seconds[i] = seconds[count - 1];
+                        times[i] = times[count - 1];
+                    }
 
-                        u64 seed = sha.hashSeed(alpha);
-                        if (valid(seed))
-                        {
-                            std::lock_guard<std::mutex> lock(mutex);
-                            results.emplace_back(seed, static_cast<u16>(timer0), static_cast<u8>(vcount), static_cast<u8>(vframe),
-                                                 static_cast<u8>(gxStat), second);
-                        }
+                    sha.setTimer0(timer0, vcounts);
+                    sha.setTime(times, dsType);
+                    auto alpha = sha.precompute();
+                    auto seeds = sha.hashSeed(alpha);
+
+                    u16 mask = validBatch(seeds.data(), count);
+                    while (mask != 0)
+                    {
+                        int i = std::countr_zero(mask);
+                        mask &= mask - 1;
+
+                        std::lock_guard<std::mutex> lock(mutex);
+                        results.emplace_back(seeds[i], static_cast<u16>(timer0), vcounts[i], static_cast<u8>(vframe),
+                                             static_cast<u8>(gxStat), seconds[i]);
                     }
                 }
                 progress++;
@@ -122,6 +171,19 @@ void ProfileSearcher5::search(u8 minVFrame, u8 maxVFrame)
     }
 }
 
+u16 ProfileSearcher5::validBatch(const u64 *seeds, u8 count)
+{
+    u16 mask = 0;
+    for (u8 i = 0; i < count; i++)
+    {
+        if (valid(seeds[i]))
+        {
+            mask |= 1 << i;
+        }
+    }
+    return mask;
+}
+
 ProfileIVSearcher5::ProfileIVSearcher5(const Date &date, const Time &time, int minSeconds, int maxSeconds, u8 minVCount, u8 maxVCount,
                                        u16 minTimer0, u16 maxTimer0, u8 minGxStat, u8 maxGxStat, Game version, Language language,
                                        DSType dsType, u64 mac, Buttons buttons, const std::array<u8, 6> &minIVs,
@@ -150,6 +212,39 @@ bool ProfileIVSearcher5::valid(u64 seed)
     return true;
 }
 
+u16 ProfileIVSearcher5::validBatch(const u64 *seeds, u8 count)
+{
+    u16 mask = 0;
+    for (u8 i = 0; i < count; i += 4)
+    {
+        // Lanes past the end of the batch repeat the last seed and are discarded
+        u32 lane[4];
+        for (u8 j = 0; j < 4; j++)
+        {
+            lane[j] = seeds[std::min<u8>(i + j, count - 1)] >> 32;
+        }
+
+        MTFastMulti<8, true> rng(vuint128(lane[0], lane[1], lane[2], lane[3]), offset);
+
+        u8 lanes = (1 << std::min<u8>(count - i, 4)) - 1;
+        for (u8 j = 0; j < 6 && lanes != 0; j++)
+        {
+            vuint128 ivs = rng.next();
+            for (u8 k = 0; k < 4; k++)
+            {
+                u8 iv = ivs.uint32[k];
+                if (iv < minIVs[j] || iv > maxIVs[j])
+                {
+                    lanes &= ~(1 << k);
+                }
+            }
+        }
+
+        mask |= lanes << i;
+    }
+    return mask;
+}
+
 ProfileNeedleSearcher5::ProfileNeedleSearcher5(const Date &date, const Time &time, int minSeconds, int maxSeconds, u8 minVCount,
                                                u8 maxVCount, u16 minTimer0, u16 maxTimer0, u8 minGxStat, u8 maxGxStat, Game version,
                                                Language language, DSType dsType, u64 mac, Buttons buttons, const std::vector<u8> &needles,
@@ -191,6 +286,44 @@ bool ProfileNeedleSearcher5::valid(u64 seed)
     return true;
 }
 
+u16 ProfileNeedleSearcher5::validBatch(const u64 *seeds, u8 count)
+{
+    u32 advances[16];
+    if (game)
+    {
+        Utilities5::initialAdvancesBW(seeds, count, advances);
+    }
+    else
+    {
+        Utilities5::initialAdvancesBW2(seeds, count, memoryLink, advances);
+    }
+
+    u16 mask = 0;
+    for (u8 i = 0; i < count; i++)
+    {
+        // Opening the menu advances 1
+        BWRNG rng(seeds[i], advances[i] + (unovaLink && !memoryLink));
+
+        bool match = true;
+        for (u8 needle : needles)
+        {
+            if (rng.nextUInt(8) != needle)
+            {
+                match = false;
+                break;
+            }
+
+            if (unovaLink)
+            {
+                rng.next();
+            }
+        }
+
+        mask |= match << i;
+    }
+    return mask;
+}
+
 ProfileSeedSearcher5::ProfileSeedSearcher5(const Date &date, const Time &time, int minSeconds, int maxSeconds, u8 minVCount, u8 maxVCount,
                                            u16 minTimer0, u16 maxTimer0, u8 minGxStat, u8 maxGxStat, Game version, Language language,
                                            DSType dsType, u64 mac, Buttons buttons, u64 seed) :
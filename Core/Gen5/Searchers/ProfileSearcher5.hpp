@@ -93,6 +93,18 @@ private:
      */
     void search(u8 minVFrame, u8 maxVFrame);
 
+    /**
+     * @brief Searches between \p minVFrame and \p maxVFrame for potentional matches, filling each lane of \p SHA with a different
+     * VCount/second combination
+     *
+     * @tparam SHA SHA1 implementation to hash with
+     * @tparam lanes Number of lanes of \p SHA
+     * @param minVFrame Minimum VFrame
+     * @param maxVFrame Maximum VFrame
+     */
+    template <class SHA, int lanes>
+    void searchLanes(u8 minVFrame, u8 maxVFrame);
+
     // protected:
     /**
      * @brief Checks if seed matches the provided calibration data
@@ -103,6 +115,16 @@ private:
      * @return false Seed is not valid
      */
     virtual bool valid(u64 seed) = 0;
+
+    /**
+     * @brief Checks which of the \p count seeds match the provided calibration data
+     *
+     * @param seeds PRNG states
+     * @param count Number of PRNG states
+     *
+     * @return Bitmask of the valid seeds
+     */
+    virtual u16 validBatch(const u64 *seeds, u8 count);
 };
 
 /**
@@ -150,6 +172,16 @@ private:
      * @return false Seed is not valid
      */
     bool valid(u64 seed) final;
+
+    /**
+     * @brief Checks which of the \p count seeds match the provided calibration IVs. Computes the IVs of 4 seeds at once.
+     *
+     * @param seeds PRNG states
+     * @param count Number of PRNG states
+     *
+     * @return Bitmask of the valid seeds
+     */
+    u16 validBatch(const u64 *seeds, u8 count) final;
 };
 
 /**
@@ -199,6 +231,17 @@ private:
      * @return false Seed is not valid
      */
     bool valid(u64 seed) final;
+
+    /**
+     * @brief Checks which of the \p count seeds match the provided calibration needles. Computes the initial advances of the seeds
+     * together.
+     *
+     * @param seeds PRNG states
+     * @param count Number of PRNG states
+     *
+     * @return Bitmask of the valid seeds
+     */
+    u16 validBatch(const u64 *seeds, u8 count) final;
 };
 
 /**
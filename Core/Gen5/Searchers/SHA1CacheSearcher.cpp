@@ -23,210 +23,304 @@
 #include <Core/Enum/Game.hpp>
 #include <Core/Enum/Language.hpp>
 #include <Core/Gen5/IVCache.hpp>
+#include <Core/Parents/Searchers/TileScheduler.hpp>
 #include <Core/RNG/SHA1.hpp>
 #include <Core/Util/DateTime.hpp>
+#include <bit>
+#include <filesystem>
 #include <fstream>
+#include <sstream>
 #include <thread>
 
 template <typename Type>
-static void write(std::ofstream &file, Type val)
+static void write(std::ostream &file, Type val)
 {
     file.write(reinterpret_cast<char *>(&val), sizeof(val));
 }
 
-SHA1CacheSearcher::SHA1CacheSearcher(const IVCache &ivCache, const Profile5 &profile, const Date &start, const Date &end) :
-    SearcherBase<SHA1Seed>(), profile(profile), keypresses(Keypresses::getKeypresses()), end(end), start(start), initialAdvances(ivCache.getInitialAdvances()), maxAdvances(ivCache.getMaxAdvances())
+SHA1CacheSearcher::SHA1CacheSearcher(const IVCache &ivCache, const Profile5 &profile, const Date &start, const Date &end,
+                                     std::string_view checkpoint) :
+    SearcherBase<SHA1Seed>(),
+    ivFilter(ivCache.getSeeds(profile.getVersion(), CacheType::Entralink), ivCache.getSeeds(profile.getVersion(), CacheType::Normal),
+             ivCache.getSeeds(profile.getVersion(), CacheType::Roamer)),
+    profile(profile),
+    keypresses(Keypresses::getKeypresses()),
+    end(end),
+    start(start),
+    initialAdvances(ivCache.getInitialAdvances()),
+    maxAdvances(ivCache.getMaxAdvances()),
+    checkpoint(checkpoint, getHeader(false),
+               static_cast<u64>(keypresses.size()) * (start.daysTo(end) + 1) * (profile.getTimer0Max() - profile.getTimer0Min() + 1), 3,
+               sizeof(SHA1Seed))
 {
-    entralinkSeeds = ivCache.getSeeds(profile.getVersion(), CacheType::Entralink);
-    normalSeeds = ivCache.getSeeds(profile.getVersion(), CacheType::Normal);
-    roamerSeeds = ivCache.getSeeds(profile.getVersion(), CacheType::Roamer);
 }
 
 void SHA1CacheSearcher::startSearch(int threads)
 {
     this->searching = true;
 
-    auto days = start.daysTo(end) + 1;
-    if (days < threads)
+    u32 days = start.daysTo(end) + 1;
+    u64 tiles = static_cast<u64>(keypresses.size()) * days * (profile.getTimer0Max() - profile.getTimer0Min() + 1);
+    // An empty search still needs one thread for the scheduler to split the tiles over
+    threads = static_cast<int>(std::max<u64>(1, std::min<u64>(tiles, threads)));
+
+    TileScheduler scheduler(tiles, threads);
+    auto *threadContainer = new std::thread[threads];
+
+    for (int i = 0; i < threads; i++)
     {
-        threads = days;
+        threadContainer[i] = std::thread([this, &scheduler, days, i] {
+            u64 tile;
+            while (this->searching && scheduler.next(i, tile))
+            {
+                // Tiles finished by an earlier run of the search are already stored in the checkpoint
+                if (checkpoint.isComplete(tile))
+                {
+                    this->progress++;
+                    continue;
+                }
+
+                u64 index = tile;
+                const auto &keypress = keypresses[index % keypresses.size()];
+                index /= keypresses.size();
+
+                Date date = start + static_cast<u32>(index % days);
+                index /= days;
+
+                std::array<std::vector<SHA1Seed>, 3> seeds;
+                search(profile.getTimer0Min() + index, date, keypress, seeds);
+
+                if (this->searching)
+                {
+                    // Stop the search if the tile could not be stored, the cache would be missing its results otherwise
+                    if (!checkpoint.write<SHA1Seed>(tile, { &seeds[0], &seeds[1], &seeds[2] }))
+                    {
+                        this->searching = false;
+                    }
+                }
+            }
+        });
     }
 
-    auto *threadContainer = new std::thread[threads];
+    for (int i = 0; i < threads; i++)
+    {
+        threadContainer[i].join();
+    }
+
+    delete[] threadContainer;
+}
+
+bool SHA1CacheSearcher::failed() const
+{
+    return checkpoint.failed();
+}
 
-    auto daysSplit = days / threads;
-    Date day = start;
-    for (int i = 0; i < threads; i++, day += daysSplit)
+bool SHA1CacheSearcher::writeResults(std::string_view file, bool compress)
+{
+    std::ofstream stream(file.data(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!stream.is_open())
     {
-        if (i == threads - 1)
+        return false;
+    }
+
+    std::string header = getHeader(compress);
+    stream.write(header.data(), header.size());
+
+    u32 days = start.daysTo(end) + 1;
+    u32 timer0s = profile.getTimer0Max() - profile.getTimer0Min() + 1;
+
+    // Join the tiles of each day into a temporary file first, so the checkpoint is read once for all three sections.
+    // Each section is stored in day order, and the index of the first seed of every day is kept to read them back.
+    std::string temp = std::string(file) + ".tmp";
+    std::fstream seeds(temp, std::ios_base::in | std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    bool good = seeds.is_open();
+
+    std::array<u64, 3> sections;
+    std::array<u64, 3> positions;
+    std::array<std::vector<u64>, 3> indexes;
+    for (u8 section = 0; section < 3; section++)
+    {
+        sections[section] = section == 0 ? 0 : sections[section - 1] + checkpoint.getTotal(section - 1) * sizeof(SHA1Seed);
+        positions[section] = sections[section];
+        indexes[section].resize(days + 1);
+    }
+
+    std::vector<std::vector<SHA1Seed>> lists;
+    for (u32 day = 0; good && day < days; day++)
+    {
+        for (u64 timer0 = 0; good && timer0 < timer0s; timer0++)
         {
-            threadContainer[i] = std::thread([=] { search(day, end); });
+            for (u64 keypress = 0; good && keypress < keypresses.size(); keypress++)
+            {
+                good = checkpoint.read(keypress + keypresses.size() * (day + days * timer0), lists);
+                for (u8 section = 0; good && section < 3; section++)
+                {
+                    if (!lists[section].empty())
+                    {
+                        seeds.seekp(positions[section]);
+                        seeds.write(reinterpret_cast<const char *>(lists[section].data()), lists[section].size() * sizeof(SHA1Seed));
+                        positions[section] += lists[section].size() * sizeof(SHA1Seed);
+                    }
+                }
+            }
         }
-        else
+
+        for (u8 section = 0; section < 3; section++)
         {
-            Date mid = day + (daysSplit - 1);
-            threadContainer[i] = std::thread([=] { search(day, mid); });
+            indexes[section][day + 1] = (positions[section] - sections[section]) / sizeof(SHA1Seed);
         }
     }
+    good = good && seeds.flush();
 
-    for (int i = 0; i < threads; i++)
+    SHA1Cache::writeSeeds(
+        stream, start, end,
+        [&](u8 section, u32 day) {
+            std::vector<SHA1Seed> records(good ? indexes[section][day + 1] - indexes[section][day] : 0);
+            if (!records.empty())
+            {
+                seeds.seekg(sections[section] + indexes[section][day] * sizeof(SHA1Seed));
+                seeds.read(reinterpret_cast<char *>(records.data()), records.size() * sizeof(SHA1Seed));
+                good = static_cast<bool>(seeds);
+            }
+            return records;
+        },
+        compress);
+
+    seeds.close();
+    std::error_code error;
+    std::filesystem::remove(temp, error);
+
+    stream.close();
+    if (!good || !stream)
     {
-        threadContainer[i].join();
+        // Keep the checkpoint so the cache can be written again, and do not leave an incomplete cache behind
+        std::filesystem::remove(file, error);
+        return false;
     }
 
-    delete[] threadContainer;
+    checkpoint.remove();
+    return true;
 }
 
-void SHA1CacheSearcher::writeResults(std::string_view file)
+std::string SHA1CacheSearcher::getHeader(bool compress) const
 {
-    auto sort = [](const SHA1Seed &first, const SHA1Seed &second) { return first.seed < second.seed; };
+    std::ostringstream stream;
 
-    std::ofstream stream(file.data(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
-    if (stream.is_open())
+    // Write magic identifier: CRC32 of "SHA1CacheV2"
+    write(stream, 0x7b59cac9);
+
+    // Write cache advances
+    write(stream, initialAdvances);
+    write(stream, maxAdvances);
+
+    // Write profile data
+    write(stream, profile.getMac());
+    write(stream, end);
+    write(stream, start);
+    write(stream, profile.getVersion());
+    write(stream, profile.getTimer0Max());
+    write(stream, profile.getTimer0Min());
+    write(stream, compress);
+    write(stream, profile.getDSType());
+    write(stream, profile.getLanguage());
+    write(stream, profile.getGxStat());
+    write(stream, profile.getVCount());
+    write(stream, profile.getVFrame());
+
+    return stream.str();
+}
+
+template <size_t size>
+void SHA1CacheSearcher::checkSeeds(const std::array<u64, size> &seeds, u16 timer0, const Date &date, const Keypress &keypress, u32 time,
+                                   std::array<std::vector<SHA1Seed>, 3> &results)
+{
+    // Test every lane against the bloom filter first so the hash loop stays branch free
+    u16 mask = 0;
+    for (u32 i = 0; i < size; i++)
     {
-        // Write magic identifier: CRC32 of "SHA1Cache"
-        write(stream, 0x3c50a97e);
-
-        // Write cache advances
-        write(stream, initialAdvances);
-        write(stream, maxAdvances);
-
-        // Write profile data
-        write(stream, profile.getMac());
-        write(stream, end);
-        write(stream, start);
-        write(stream, profile.getVersion());
-        write(stream, profile.getTimer0Max());
-        write(stream, profile.getTimer0Min());
-        write(stream, (u8)0);
-        write(stream, profile.getDSType());
-        write(stream, profile.getLanguage());
-        write(stream, profile.getGxStat());
-        write(stream, profile.getVCount());
-        write(stream, profile.getVFrame());
-
-        // Write seed sizes
-        std::ranges::sort(results, sort);
-        std::ranges::sort(normalResults, sort);
-        std::ranges::sort(roamerResults, sort);
-
-        write<u32>(stream, results.size());
-        write<u32>(stream, normalResults.size());
-        write<u32>(stream, roamerResults.size());
-
-        // Write seed data
-        stream.write(reinterpret_cast<char *>(results.data()), results.size() * sizeof(SHA1Seed));
-        stream.write(reinterpret_cast<char *>(normalResults.data()), normalResults.size() * sizeof(SHA1Seed));
-        stream.write(reinterpret_cast<char *>(roamerResults.data()), roamerResults.size() * sizeof(SHA1Seed));
+        mask |= static_cast<u16>(ivFilter.mayContain(seeds[i] >> 32)) << i;
+    }
+
+    for (; mask != 0; mask &= mask - 1)
+    {
+        int i = std::countr_zero(mask);
+        u8 types = ivFilter.getTypes(seeds[i] >> 32);
+        for (u8 type = 0; type < results.size(); type++)
+        {
+            if (types & (1 << type))
+            {
+                results[type].emplace_back(toInt(keypress.button), time + i, date.getJD() - Date().getJD(), timer0, seeds[i]);
+            }
+        }
     }
 }
 
-void SHA1CacheSearcher::search(const Date &start, const Date &end)
+void SHA1CacheSearcher::search(u16 timer0, const Date &date, const Keypress &keypress, std::array<std::vector<SHA1Seed>, 3> &results)
 {
 #ifdef SIMD_X86
-    if (hasAVX2())
+    if (hasAVX512())
+    {
+        SHA1AVX512 sha(this->profile);
+        sha.setTimer0(timer0, this->profile.getVCount());
+        sha.setDate(date);
+        auto alpha = sha.precompute();
+        sha.setButton(keypress.value);
+
+        for (u32 time = 0; time < 86400; time += 16)
+        {
+            if (!this->searching)
+            {
+                return;
+            }
+
+            sha.setTime(time, this->profile.getDSType());
+            auto seeds = sha.hashSeed(alpha);
+
+            checkSeeds(seeds, timer0, date, keypress, time, results);
+        }
+    }
+    else if (hasAVX2())
     {
         SHA1AVX2 sha(this->profile);
-        for (u16 timer0 = this->profile.getTimer0Min(); timer0 <= this->profile.getTimer0Max(); timer0++)
+        sha.setTimer0(timer0, this->profile.getVCount());
+        sha.setDate(date);
+        auto alpha = sha.precompute();
+        sha.setButton(keypress.value);
+
+        for (u32 time = 0; time < 86400; time += 8)
         {
-            sha.setTimer0(timer0, this->profile.getVCount());
-            for (Date date = start; date <= end; ++date)
+            if (!this->searching)
             {
-                sha.setDate(date);
-                auto alpha = sha.precompute();
-                for (const auto &keypress : this->keypresses)
-                {
-                    sha.setButton(keypress.value);
-                    for (u32 time = 0; time < 86400; time += 8)
-                    {
-                        if (!this->searching)
-                        {
-                            return;
-                        }
-
-                        sha.setTime(time, this->profile.getDSType());
-                        auto seeds = sha.hashSeed(alpha);
-
-                        for (u32 i = 0; i < seeds.size(); i++)
-                        {
-                            if (std::ranges::binary_search(entralinkSeeds, seeds[i] >> 32))
-                            {
-                                std::lock_guard<std::mutex> lock(this->mutex);
-                                this->results.emplace_back(toInt(keypress.button), time + i, date.getJD() - Date().getJD(), timer0,
-                                                           seeds[i]);
-                            }
-
-                            if (std::ranges::binary_search(normalSeeds, seeds[i] >> 32))
-                            {
-                                std::lock_guard<std::mutex> lock(this->mutex);
-                                this->normalResults.emplace_back(toInt(keypress.button), time + i, date.getJD() - Date().getJD(), timer0,
-                                                                 seeds[i]);
-                            }
-
-                            if (std::ranges::binary_search(roamerSeeds, seeds[i] >> 32))
-                            {
-                                std::lock_guard<std::mutex> lock(this->mutex);
-                                this->roamerResults.emplace_back(toInt(keypress.button), time + i, date.getJD() - Date().getJD(), timer0,
-                                                                 seeds[i]);
-                            }
-                        }
-                    }
-                    this->progress++;
-                }
+                return;
             }
+
+            sha.setTime(time, this->profile.getDSType());
+            auto seeds = sha.hashSeed(alpha);
+
+            checkSeeds(seeds, timer0, date, keypress, time, results);
         }
     }
     else
 #endif
     {
         SHA1SSE sha(this->profile);
-        for (u16 timer0 = this->profile.getTimer0Min(); timer0 <= this->profile.getTimer0Max(); timer0++)
+        sha.setTimer0(timer0, this->profile.getVCount());
+        sha.setDate(date);
+        auto alpha = sha.precompute();
+        sha.setButton(keypress.value);
+
+        for (u32 time = 0; time < 86400; time += 4)
         {
-            sha.setTimer0(timer0, this->profile.getVCount());
-            for (Date date = start; date <= end; ++date)
+            if (!this->searching)
             {
-                sha.setDate(date);
-                auto alpha = sha.precompute();
-                for (const auto &keypress : this->keypresses)
-                {
-                    sha.setButton(keypress.value);
-                    for (u32 time = 0; time < 86400; time += 4)
-                    {
-                        if (!this->searching)
-                        {
-                            return;
-                        }
-
-                        sha.setTime(time, this->profile.getDSType());
-                        auto seeds = sha.hashSeed(alpha);
-
-                        for (u32 i = 0; i < seeds.size(); i++)
-                        {
-                            if (std::ranges::binary_search(entralinkSeeds, seeds[i] >> 32))
-                            {
-                                std::lock_guard<std::mutex> lock(this->mutex);
-                                this->results.emplace_back(toInt(keypress.button), time + i, date.getJD() - Date().getJD(), timer0,
-                                                           seeds[i]);
-                            }
-
-                            if (std::ranges::binary_search(normalSeeds, seeds[i] >> 32))
-                            {
-                                std::lock_guard<std::mutex> lock(this->mutex);
-                                this->normalResults.emplace_back(toInt(keypress.button), time + i, date.getJD() - Date().getJD(), timer0,
-                                                                 seeds[i]);
-                            }
-
-                            if (std::ranges::binary_search(roamerSeeds, seeds[i] >> 32))
-                            {
-                                std::lock_guard<std::mutex> lock(this->mutex);
-                                this->roamerResults.emplace_back(toInt(keypress.button), time + i, date.getJD() - Date().getJD(), timer0,
-                                                                 seeds[i]);
-                            }
-                        }
-                    }
-                    this->progress++;
-                }
+                return;
             }
+
+            sha.setTime(time, this->profile.getDSType());
+            auto seeds = sha.hashSeed(alpha);
+
+            checkSeeds(seeds, timer0, date, keypress, time, results);
         }
     }
+    this->progress++;
 }
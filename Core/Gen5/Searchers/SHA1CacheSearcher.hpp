@@ -20,9 +20,11 @@
 #ifndef SHA1CACHESEARCHER_HPP
 #define SHA1CACHESEARCHER_HPP
 
+#include <Core/Gen5/Filters/IVCacheFilter.hpp>
 #include <Core/Gen5/Keypresses.hpp>
 #include <Core/Gen5/Profile5.hpp>
 #include <Core/Gen5/SHA1Cache.hpp>
+#include <Core/Parents/Searchers/SearchCheckpoint.hpp>
 #include <Core/Parents/Searchers/SearcherBase.hpp>
 #include <Core/Util/DateTime.hpp>
 
@@ -44,8 +46,17 @@ public:
      * @param profile Profile information
      * @param start Start date
      * @param end End date
+     * @param checkpoint Path of the checkpoint file, the search continues from it if it already exists
      */
-    SHA1CacheSearcher(const IVCache &ivCache, const Profile5 &profile, const Date &start, const Date &end);
+    SHA1CacheSearcher(const IVCache &ivCache, const Profile5 &profile, const Date &start, const Date &end, std::string_view checkpoint);
+
+    /**
+     * @brief Returns if storing or reading the results in the checkpoint failed. The search stops when a result could not be stored.
+     *
+     * @return true Checkpoint failed
+     * @return false Checkpoint is fine
+     */
+    bool failed() const;
 
     /**
      * @brief Computes max progress
@@ -67,32 +78,59 @@ public:
     void startSearch(int threads);
 
     /**
-     * @brief Writes cache results to file
+     * @brief Writes cache results to file and removes the checkpoint
      *
      * @param file Path to write files too
+     * @param compress Whether to compress the seeds
+     *
+     * @return true Cache was written
+     * @return false Writing the cache or reading the checkpoint failed, the checkpoint is kept
      */
-    void writeResults(std::string_view file);
+    bool writeResults(std::string_view file, bool compress = false);
 
 private:
+    IVCacheFilter ivFilter;
     Profile5 profile;
     std::vector<Keypress> keypresses;
-    std::vector<u32> entralinkSeeds;
-    std::vector<u32> normalSeeds;
-    std::vector<SHA1Seed> normalResults;
-    std::vector<u32> roamerSeeds;
-    std::vector<SHA1Seed> roamerResults;
     Date end;
     Date start;
     u32 initialAdvances;
     u32 maxAdvances;
+    SearchCheckpoint checkpoint;
 
     /**
-     * @brief Searches between the \p start and \p end dates
+     * @brief Checks the seeds of a hash against the IV cache and stores the matches
      *
-     * @param start Start date
-     * @param end End date
+     * @tparam size Number of seeds
+     * @param seeds PRNG states
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param time Time value of the first seed
+     * @param results Entralink, normal, and roamer results
+     */
+    template <size_t size>
+    void checkSeeds(const std::array<u64, size> &seeds, u16 timer0, const Date &date, const Keypress &keypress, u32 time,
+                    std::array<std::vector<SHA1Seed>, 3> &results);
+
+    /**
+     * @brief Builds the header of the cache file
+     *
+     * @param compress Whether the seeds are compressed
+     *
+     * @return Header data
+     */
+    std::string getHeader(bool compress) const;
+
+    /**
+     * @brief Searches a single tile of the search space
+     *
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param results Entralink, normal, and roamer results
      */
-    void search(const Date &start, const Date &end);
+    void search(u16 timer0, const Date &date, const Keypress &keypress, std::array<std::vector<SHA1Seed>, 3> &results);
 };
 
 #endif // SHA1CACHESEARCHER_HPP
@@ -0,0 +1,244 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SearchShard5.hpp"
+#include <Core/Gen5/Keypresses.hpp>
+#include <Core/Parents/ProfileLoader.hpp>
+#include <fstream>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+// Expected magic word is CRC32 of "SearchResults5"
+constexpr u32 MAGIC = 0x537f485e;
+
+/**
+ * @brief Gets the boundaries of splitting \p size values into \p parts evenly sized ranges
+ *
+ * @param size Number of values
+ * @param parts Number of ranges
+ * @param part Range index
+ *
+ * @return First value of the range
+ */
+static u32 getBoundary(u32 size, u32 parts, u32 part)
+{
+    return static_cast<u64>(size) * part / parts;
+}
+
+namespace SearchShards5
+{
+    std::vector<SearchShard5> split(const Profile5 &profile, const Date &start, const Date &end, u32 count)
+    {
+        std::vector<Keypress> keypresses = Keypresses::getKeypresses(profile);
+
+        std::array<u32, 3> sizes = { start.daysTo(end) + 1, static_cast<u32>(profile.getTimer0Max() - profile.getTimer0Min() + 1),
+                                     static_cast<u32>(keypresses.size()) };
+        std::array<u32, 3> parts = { 1, 1, 1 };
+
+        std::vector<u32> factors;
+        for (u32 factor = 2; factor * factor <= count; factor++)
+        {
+            for (; count % factor == 0; count /= factor)
+            {
+                factors.emplace_back(factor);
+            }
+        }
+        if (count > 1)
+        {
+            factors.emplace_back(count);
+        }
+
+        // Give the largest factors to whichever dimension has the most values left per shard
+        for (auto it = factors.rbegin(); it != factors.rend(); it++)
+        {
+            int best = -1;
+            for (int i = 0; i < 3; i++)
+            {
+                if (sizes[i] / parts[i] >= *it && (best == -1 || sizes[i] / parts[i] > sizes[best] / parts[best]))
+                {
+                    best = i;
+                }
+            }
+
+            if (best != -1)
+            {
+                parts[best] *= *it;
+            }
+        }
+
+        std::vector<SearchShard5> shards;
+        for (u32 day = 0; day < parts[0]; day++)
+        {
+            for (u32 timer0 = 0; timer0 < parts[1]; timer0++)
+            {
+                for (u32 keypress = 0; keypress < parts[2]; keypress++)
+                {
+                    SearchShard5 shard;
+                    shard.index = shards.size();
+                    shard.start = start + getBoundary(sizes[0], parts[0], day);
+                    shard.end = start + (getBoundary(sizes[0], parts[0], day + 1) - 1);
+                    shard.timer0Min = profile.getTimer0Min() + getBoundary(sizes[1], parts[1], timer0);
+                    shard.timer0Max = profile.getTimer0Min() + getBoundary(sizes[1], parts[1], timer0 + 1) - 1;
+                    for (u32 i = getBoundary(sizes[2], parts[2], keypress); i < getBoundary(sizes[2], parts[2], keypress + 1); i++)
+                    {
+                        shard.buttons.emplace_back(keypresses[i].button);
+                    }
+                    shards.emplace_back(shard);
+                }
+            }
+        }
+
+        return shards;
+    }
+
+    std::optional<SearchManifest5> readManifest(const std::string &path)
+    {
+        std::ifstream read(path);
+        if (!read.is_open())
+        {
+            return std::nullopt;
+        }
+
+        json j = json::parse(read, nullptr, false);
+        if (j.is_discarded() || !j.is_object() || !j.contains("profile") || !j.contains("shards"))
+        {
+            return std::nullopt;
+        }
+
+        try
+        {
+            SearchManifest5 manifest = { ProfileLoader5::fromJson(j["profile"].dump()), j.value("job", json::object()).dump(), {} };
+            for (const auto &s : j["shards"])
+            {
+                SearchShard5 shard;
+                shard.index = s.at("index").get<u32>();
+                shard.start = Date(s.at("start").get<u32>());
+                shard.end = Date(s.at("end").get<u32>());
+                shard.timer0Min = s.at("timer0Min").get<u16>();
+                shard.timer0Max = s.at("timer0Max").get<u16>();
+                for (u16 button : s.at("buttons"))
+                {
+                    shard.buttons.emplace_back(static_cast<Buttons>(button));
+                }
+
+                // A shard without keypresses or Timer0 values has nothing to search
+                if (shard.buttons.empty() || shard.timer0Min > shard.timer0Max)
+                {
+                    return std::nullopt;
+                }
+                manifest.shards.emplace_back(shard);
+            }
+            return manifest;
+        }
+        catch (const json::exception &)
+        {
+            return std::nullopt;
+        }
+    }
+
+    bool writeManifest(const std::string &path, const SearchManifest5 &manifest)
+    {
+        json j;
+        j["profile"] = json::parse(ProfileLoader5::toJson(manifest.profile));
+
+        json job = json::parse(manifest.job, nullptr, false);
+        j["job"] = job.is_discarded() ? json::object() : job;
+
+        json &shards = j["shards"] = json::array();
+        for (const auto &shard : manifest.shards)
+        {
+            json s;
+            s["index"] = shard.index;
+            s["start"] = shard.start.getJD();
+            s["end"] = shard.end.getJD();
+            s["timer0Min"] = shard.timer0Min;
+            s["timer0Max"] = shard.timer0Max;
+
+            json &buttons = s["buttons"] = json::array();
+            for (Buttons button : shard.buttons)
+            {
+                buttons.emplace_back(static_cast<u16>(button));
+            }
+            shards.emplace_back(s);
+        }
+
+        std::ofstream write(path);
+        write << j.dump(4);
+        return write.good();
+    }
+
+    bool readResultHeader(std::istream &stream, u32 size, u64 &count)
+    {
+        u32 magic;
+        u32 resultSize;
+        stream.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+        stream.read(reinterpret_cast<char *>(&resultSize), sizeof(resultSize));
+        stream.read(reinterpret_cast<char *>(&count), sizeof(count));
+        return stream && magic == MAGIC && resultSize == size;
+    }
+
+    bool readResultData(const std::string &path, u32 size, std::vector<u8> &data)
+    {
+        std::ifstream read(path, std::ios::binary);
+        if (!read.is_open())
+        {
+            return false;
+        }
+
+        u64 count;
+        if (!readResultHeader(read, size, count))
+        {
+            return false;
+        }
+
+        if (count == unknownCount)
+        {
+            u64 offset = read.tellg();
+            read.seekg(0, std::ios::end);
+            count = (static_cast<u64>(read.tellg()) - offset) / size;
+            read.seekg(offset);
+        }
+
+        data.resize(count * size);
+        read.read(reinterpret_cast<char *>(data.data()), data.size());
+        return static_cast<bool>(read);
+    }
+
+    void writeResultHeader(std::ostream &stream, u32 size, u64 count)
+    {
+        u32 magic = MAGIC;
+        stream.write(reinterpret_cast<const char *>(&magic), sizeof(magic));
+        stream.write(reinterpret_cast<const char *>(&size), sizeof(size));
+        stream.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    }
+
+    bool writeResultData(const std::string &path, u32 size, const void *data, u64 count)
+    {
+        std::ofstream write(path, std::ios::binary | std::ios::trunc);
+        if (!write.is_open())
+        {
+            return false;
+        }
+
+        writeResultHeader(write, size, count);
+        write.write(reinterpret_cast<const char *>(data), count * size);
+        return write.good();
+    }
+}
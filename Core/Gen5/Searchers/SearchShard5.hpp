@@ -0,0 +1,292 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHSHARD5_HPP
+#define SEARCHSHARD5_HPP
+
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/States/SearcherState5.hpp>
+#include <Core/Global.hpp>
+#include <Core/Parents/Searchers/ResultSpill.hpp>
+#include <Core/Util/DateTime.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <fstream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+enum class Buttons : u16;
+
+/**
+ * @brief Part of a Gen 5 search covering a date range, Timer0 range, and subset of keypresses
+ */
+struct SearchShard5
+{
+    Date start;
+    Date end;
+    std::vector<Buttons> buttons;
+    u32 index;
+    u16 timer0Min;
+    u16 timer0Max;
+};
+
+/**
+ * @brief Search split into shards together with everything needed to run each shard on its own
+ */
+struct SearchManifest5
+{
+    Profile5 profile;
+    std::string job;
+    std::vector<SearchShard5> shards;
+};
+
+namespace SearchShards5
+{
+    /**
+     * @brief Result count of a result file whose results continue until the end of the file
+     */
+    constexpr u64 unknownCount = ~0ULL;
+
+    /**
+     * @brief Number of bytes of results \ref mergeResults() keeps in memory before spilling sorted runs to a temporary file
+     */
+    constexpr u64 mergeBudget = 256 * 1024 * 1024;
+
+    /**
+     * @brief Splits the search into shards. The same inputs always give the same shards.
+     * The prime factors of \p count are spread over the days, Timer0 values, and keypresses, so fewer shards than \p count are
+     * returned when the search is too small to split that many times.
+     *
+     * @param profile Profile information
+     * @param start Start date
+     * @param end End date
+     * @param count Requested number of shards
+     *
+     * @return Shards covering the search exactly once
+     */
+    std::vector<SearchShard5> split(const Profile5 &profile, const Date &start, const Date &end, u32 count);
+
+    /**
+     * @brief Reads a manifest written by \ref writeManifest()
+     *
+     * @param path Path of the manifest file
+     *
+     * @return Manifest if it could be read, otherwise std::nullopt
+     */
+    std::optional<SearchManifest5> readManifest(const std::string &path);
+
+    /**
+     * @brief Writes the \p manifest as JSON
+     *
+     * @param path Path of the manifest file
+     * @param manifest Search manifest
+     *
+     * @return true Manifest was written
+     * @return false Manifest could not be written
+     */
+    bool writeManifest(const std::string &path, const SearchManifest5 &manifest);
+
+    /**
+     * @brief Reads the header of a result file written by \ref writeResultHeader() from \p stream
+     *
+     * @param stream Input stream
+     * @param size Size of a single result
+     * @param count Number of results, or \ref unknownCount when results are streamed until the end of the file
+     *
+     * @return true Header was read
+     * @return false Header is missing or belongs to results of a different size
+     */
+    bool readResultHeader(std::istream &stream, u32 size, u64 &count);
+
+    /**
+     * @brief Reads the raw results of a shard result file
+     *
+     * @param path Path of the result file
+     * @param size Size of a single result
+     * @param data Result data
+     *
+     * @return true Results were read
+     * @return false File does not exist or holds results of a different size
+     */
+    bool readResultData(const std::string &path, u32 size, std::vector<u8> &data);
+
+    /**
+     * @brief Writes the header of a result file to \p stream. The results follow the header directly.
+     *
+     * @param stream Output stream
+     * @param size Size of a single result
+     * @param count Number of results, or \ref unknownCount when results are streamed until the end of the file
+     */
+    void writeResultHeader(std::ostream &stream, u32 size, u64 count);
+
+    /**
+     * @brief Writes raw results to a shard result file
+     *
+     * @param path Path of the result file
+     * @param size Size of a single result
+     * @param data Result data
+     * @param count Number of results
+     *
+     * @return true Results were written
+     * @return false File could not be written
+     */
+    bool writeResultData(const std::string &path, u32 size, const void *data, u64 count);
+
+    /**
+     * @brief Reads the results of a shard result file
+     *
+     * @tparam State State class of the searcher
+     * @param path Path of the result file
+     * @param results Results read from the file
+     *
+     * @return true Results were read
+     * @return false File does not exist or holds results of a different type
+     */
+    template <class State>
+    bool readResults(const std::string &path, std::vector<SearcherState5<State>> &results)
+    {
+        static_assert(std::is_trivially_copyable_v<SearcherState5<State>>, "Results must be trivially copyable");
+
+        std::vector<u8> data;
+        if (!readResultData(path, sizeof(SearcherState5<State>), data))
+        {
+            return false;
+        }
+
+        // States have no default constructor, so each result is copied out of the raw bytes
+        using Bytes = std::array<u8, sizeof(SearcherState5<State>)>;
+        results.clear();
+        results.reserve(data.size() / sizeof(SearcherState5<State>));
+        for (size_t offset = 0; offset < data.size(); offset += sizeof(SearcherState5<State>))
+        {
+            results.emplace_back(std::bit_cast<SearcherState5<State>>(*reinterpret_cast<const Bytes *>(data.data() + offset)));
+        }
+        return true;
+    }
+
+    /**
+     * @brief Writes the results of a shard to a result file
+     *
+     * @tparam State State class of the searcher
+     * @param path Path of the result file
+     * @param results Search results
+     *
+     * @return true Results were written
+     * @return false File could not be written
+     */
+    template <class State>
+    bool writeResults(const std::string &path, const std::vector<SearcherState5<State>> &results)
+    {
+        static_assert(std::is_trivially_copyable_v<SearcherState5<State>>, "Results must be trivially copyable");
+        return writeResultData(path, sizeof(SearcherState5<State>), results.data(), results.size());
+    }
+
+    /**
+     * @brief Combines shard result files into one result file sorted by date/time, Timer0, and keypress.
+     * Results of the same seed keep the order the searcher produced them in. The shards are streamed in blocks and sorted runs
+     * past \ref mergeBudget are merged from a temporary file, so the results do not have to fit in memory.
+     *
+     * @tparam State State class of the searcher
+     * @param paths Paths of the shard result files
+     * @param output Path of the merged result file
+     *
+     * @return true Results were merged
+     * @return false A shard result file could not be read or the output could not be written
+     */
+    template <class State>
+    bool mergeResults(const std::vector<std::string> &paths, const std::string &output)
+    {
+        using Result = SearcherState5<State>;
+        using Bytes = std::array<u8, sizeof(Result)>;
+        static_assert(std::is_trivially_copyable_v<Result>, "Results must be trivially copyable");
+
+        constexpr u64 block = 65536;
+
+        // Every seed belongs to exactly one shard, so a stable merge gives the same order regardless of how the search was split
+        ResultSpill<Result> results(mergeBudget, Result::compare);
+        std::vector<Bytes> data(block);
+        std::vector<Result> chunk;
+        chunk.reserve(block);
+        for (const auto &path : paths)
+        {
+            std::ifstream read(path, std::ios::binary);
+            u64 count;
+            if (!read.is_open() || !readResultHeader(read, sizeof(Result), count))
+            {
+                return false;
+            }
+
+            // Files without a result count are read until the end of the file
+            while (count != 0)
+            {
+                u64 size = std::min(count, block);
+                read.read(reinterpret_cast<char *>(data.data()), size * sizeof(Result));
+                u64 loaded = read.gcount() / sizeof(Result);
+                if ((count != unknownCount && loaded != size) || read.gcount() % sizeof(Result) != 0)
+                {
+                    return false;
+                }
+
+                chunk.clear();
+                for (u64 i = 0; i < loaded; i++)
+                {
+                    chunk.emplace_back(std::bit_cast<Result>(data[i]));
+                }
+                results.add(chunk);
+
+                if (loaded != size)
+                {
+                    break;
+                }
+                if (count != unknownCount)
+                {
+                    count -= loaded;
+                }
+            }
+        }
+
+        results.finish();
+
+        std::ofstream write(output, std::ios::binary | std::ios::trunc);
+        if (!write.is_open())
+        {
+            return false;
+        }
+
+        writeResultHeader(write, sizeof(Result), results.size());
+        chunk.clear();
+        for (u64 i = 0; i < results.size(); i++)
+        {
+            chunk.emplace_back(results.get(i));
+            if (chunk.size() == block || i + 1 == results.size())
+            {
+                write.write(reinterpret_cast<const char *>(chunk.data()), chunk.size() * sizeof(Result));
+                chunk.clear();
+            }
+        }
+
+        return write.good() && !results.failed();
+    }
+}
+
+#endif // SEARCHSHARD5_HPP
@@ -0,0 +1,273 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SearchStore5.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <nlohmann/json.hpp>
+#include <set>
+#include <sstream>
+
+using json = nlohmann::json;
+
+// Size of the result file header written by SearchShards5::writeResultHeader()
+constexpr u64 HEADER_SIZE = 16;
+
+/**
+ * @brief Computes the FNV-1a hash of \p text, which names the files of a fingerprint
+ *
+ * @param text Text to hash
+ *
+ * @return Hash
+ */
+static u64 hash(const std::string &text)
+{
+    u64 value = 0xcbf29ce484222325;
+    for (char c : text)
+    {
+        value = (value ^ static_cast<u8>(c)) * 0x100000001b3;
+    }
+    return value;
+}
+
+SearchStore5::SearchStore5(const std::string &directory, const std::string &fingerprint, u32 size) :
+    fingerprint(fingerprint), count(0), size(size)
+{
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << hash(fingerprint);
+    path = (std::filesystem::path(directory) / name.str()).string();
+
+    std::ifstream read(path + ".json");
+    json j = json::parse(read, nullptr, false);
+
+    // Anything that does not belong to this fingerprint is replaced by the first search that is stored
+    if (j.is_discarded() || j.value("fingerprint", "") != fingerprint || j.value("size", 0u) != size)
+    {
+        return;
+    }
+
+    try
+    {
+        count = j.at("count").get<u64>();
+        for (const auto &range : j.at("covered"))
+        {
+            covered.emplace_back(Range { Date(range.at("start").get<u32>()), Date(range.at("end").get<u32>()),
+                                         range.at("timer0Min").get<u16>(), range.at("timer0Max").get<u16>() });
+        }
+    }
+    catch (const json::exception &)
+    {
+        count = 0;
+        covered.clear();
+        return;
+    }
+
+    // The index is only trusted if the result file still holds the results it counts
+    std::ifstream results(path + ".results", std::ios::binary);
+    u64 header;
+    u64 fileSize = std::filesystem::file_size(path + ".results", error);
+    if (!SearchShards5::readResultHeader(results, size, header) || header != SearchShards5::unknownCount || error
+        || fileSize < HEADER_SIZE + count * size)
+    {
+        count = 0;
+        covered.clear();
+    }
+}
+
+bool SearchStore5::add(const SearchShard5 &shard, const void *data, u64 count)
+{
+    std::string results = path + ".results";
+
+    std::error_code error;
+    bool exists = std::filesystem::exists(results, error);
+    if (!exists || this->count == 0)
+    {
+        // Covered ranges without their results are useless, so the store starts over
+        if (!exists)
+        {
+            this->count = 0;
+            covered.clear();
+        }
+
+        // Without results the file may still have the header of a discarded index, so it is always written again
+        std::ofstream write(results, std::ios::binary | std::ios::trunc);
+        SearchShards5::writeResultHeader(write, size, SearchShards5::unknownCount);
+        write.close();
+        if (!write)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        // Results of a search that stopped before its range was saved are not covered, so they are dropped
+        std::filesystem::resize_file(results, HEADER_SIZE + this->count * size, error);
+        if (error)
+        {
+            return false;
+        }
+    }
+
+    std::ofstream write(results, std::ios::binary | std::ios::app);
+    write.write(reinterpret_cast<const char *>(data), count * size);
+    write.close();
+    if (!write)
+    {
+        return false;
+    }
+
+    // Join the range with a covered range it extends to keep the index small
+    Range range = { shard.start, shard.end, shard.timer0Min, shard.timer0Max };
+    auto it = std::find_if(covered.begin(), covered.end(), [&range](const Range &other) {
+        return other.timer0Min == range.timer0Min && other.timer0Max == range.timer0Max
+            && (other.end + 1 == range.start || range.end + 1 == other.start);
+    });
+    if (it != covered.end())
+    {
+        it->start = std::min(it->start, range.start);
+        it->end = std::max(it->end, range.end);
+    }
+    else
+    {
+        covered.emplace_back(range);
+    }
+
+    this->count += count;
+    return save();
+}
+
+std::vector<SearchShard5> SearchStore5::getMissing(const SearchShard5 &search) const
+{
+    // Split the dates at every boundary of a covered range, each part then has the same covered Timer0 values for all of its days
+    std::set<u32> boundaries = { search.start.getJD(), search.end.getJD() + 1 };
+    for (const auto &range : covered)
+    {
+        if (range.start <= search.end && range.end >= search.start)
+        {
+            boundaries.emplace(std::max(range.start, search.start).getJD());
+            boundaries.emplace(std::min(range.end, search.end).getJD() + 1);
+        }
+    }
+
+    std::vector<SearchShard5> shards;
+    std::vector<std::pair<u16, u16>> previous;
+    u32 previousStart = 0;
+
+    auto emit = [&](u32 end) {
+        for (const auto &timer0 : previous)
+        {
+            shards.emplace_back(SearchShard5 { Date(previousStart), Date(end - 1), search.buttons, static_cast<u32>(shards.size()),
+                                               timer0.first, timer0.second });
+        }
+    };
+
+    for (auto it = boundaries.begin(); std::next(it) != boundaries.end(); ++it)
+    {
+        Date day(*it);
+
+        std::vector<bool> searched(search.timer0Max - search.timer0Min + 1, false);
+        for (const auto &range : covered)
+        {
+            if (range.start <= day && range.end >= day)
+            {
+                for (u32 timer0 = std::max(range.timer0Min, search.timer0Min); timer0 <= std::min(range.timer0Max, search.timer0Max);
+                     timer0++)
+                {
+                    searched[timer0 - search.timer0Min] = true;
+                }
+            }
+        }
+
+        std::vector<std::pair<u16, u16>> missing;
+        for (u32 i = 0; i < searched.size(); i++)
+        {
+            if (!searched[i])
+            {
+                u16 timer0 = search.timer0Min + i;
+                if (!missing.empty() && missing.back().second + 1 == timer0)
+                {
+                    missing.back().second = timer0;
+                }
+                else
+                {
+                    missing.emplace_back(timer0, timer0);
+                }
+            }
+        }
+
+        // Consecutive parts missing the same Timer0 values are searched together
+        if (missing != previous)
+        {
+            emit(*it);
+            previous = missing;
+            previousStart = *it;
+        }
+    }
+    emit(search.end.getJD() + 1);
+
+    return shards;
+}
+
+std::vector<u8> SearchStore5::readData() const
+{
+    std::vector<u8> data;
+    if (count == 0 || !SearchShards5::readResultData(path + ".results", size, data))
+    {
+        return {};
+    }
+
+    data.resize(std::min<u64>(data.size(), count * size));
+    return data;
+}
+
+bool SearchStore5::save() const
+{
+    json j;
+    j["fingerprint"] = fingerprint;
+    j["size"] = size;
+    j["count"] = count;
+
+    json &ranges = j["covered"] = json::array();
+    for (const auto &range : covered)
+    {
+        ranges.emplace_back(json { { "start", range.start.getJD() },
+                                   { "end", range.end.getJD() },
+                                   { "timer0Min", range.timer0Min },
+                                   { "timer0Max", range.timer0Max } });
+    }
+
+    // Replace the index in one step so an interrupted write keeps the previous index
+    std::string temporary = path + ".json.tmp";
+    {
+        std::ofstream write(temporary);
+        write << j.dump();
+        if (!write)
+        {
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, path + ".json", error);
+    return !error;
+}
@@ -0,0 +1,158 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHSTORE5_HPP
+#define SEARCHSTORE5_HPP
+
+#include <Core/Gen5/Searchers/SearchShard5.hpp>
+#include <Core/Gen5/States/SearcherState5.hpp>
+#include <Core/Global.hpp>
+#include <Core/Util/DateTime.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Keeps the results of Gen 5 searches on disk together with the (date, Timer0) ranges they cover, so that extending a search
+ * only has to search the part that was not covered before.
+ * Searches are identified by a fingerprint of everything except the date and Timer0 ranges: the profile, including its keypresses,
+ * and the generator, searcher, and filter settings. Every stored range covers all keypresses of the profile.
+ */
+class SearchStore5
+{
+public:
+    /**
+     * @brief Construct a new SearchStore5 object. Stored results of the same \p fingerprint are loaded from \p directory.
+     *
+     * @param directory Directory of the store
+     * @param fingerprint Search fingerprint
+     * @param size Size of a single result
+     */
+    SearchStore5(const std::string &directory, const std::string &fingerprint, u32 size);
+
+    /**
+     * @brief Stores the results of a completed \p shard and marks its range as covered
+     *
+     * @param shard Searched shard
+     * @param data Result data
+     * @param count Number of results
+     *
+     * @return true Results were stored
+     * @return false Store could not be written
+     */
+    bool add(const SearchShard5 &shard, const void *data, u64 count);
+
+    /**
+     * @brief Stores the results of a completed \p shard and marks its range as covered
+     *
+     * @tparam State State class of the searcher
+     * @param shard Searched shard
+     * @param results Search results
+     *
+     * @return true Results were stored
+     * @return false Store could not be written
+     */
+    template <class State>
+    bool add(const SearchShard5 &shard, const std::vector<SearcherState5<State>> &results)
+    {
+        static_assert(std::is_trivially_copyable_v<SearcherState5<State>>, "Results must be trivially copyable");
+        return add(shard, results.data(), results.size());
+    }
+
+    /**
+     * @brief Returns the parts of the \p search that have not been covered. The keypresses of \p search are copied to each part.
+     *
+     * @param search Search covering all keypresses of the profile
+     *
+     * @return Shards that still have to be searched
+     */
+    std::vector<SearchShard5> getMissing(const SearchShard5 &search) const;
+
+    /**
+     * @brief Reads the stored results that are inside the date and Timer0 range of the \p search, sorted by date/time, Timer0, and
+     * keypress
+     *
+     * @tparam State State class of the searcher
+     * @param search Search range
+     *
+     * @return Stored results
+     */
+    template <class State>
+    std::vector<SearcherState5<State>> read(const SearchShard5 &search) const
+    {
+        static_assert(std::is_trivially_copyable_v<SearcherState5<State>>, "Results must be trivially copyable");
+
+        std::vector<u8> data = readData();
+
+        using Bytes = std::array<u8, sizeof(SearcherState5<State>)>;
+        std::vector<SearcherState5<State>> results;
+        for (size_t offset = 0; offset < data.size(); offset += sizeof(SearcherState5<State>))
+        {
+            auto result = std::bit_cast<SearcherState5<State>>(*reinterpret_cast<const Bytes *>(data.data() + offset));
+
+            Date date = result.getDateTime().getDate();
+            if (date >= search.start && date <= search.end && result.getTimer0() >= search.timer0Min
+                && result.getTimer0() <= search.timer0Max)
+            {
+                results.emplace_back(result);
+            }
+        }
+
+        std::stable_sort(results.begin(), results.end(), SearcherState5<State>::compare);
+        return results;
+    }
+
+private:
+    /**
+     * @brief Date and Timer0 range that has been searched
+     */
+    struct Range
+    {
+        Date start;
+        Date end;
+        u16 timer0Min;
+        u16 timer0Max;
+    };
+
+    std::string fingerprint;
+    std::string path;
+    std::vector<Range> covered;
+    u64 count;
+    u32 size;
+
+    /**
+     * @brief Reads the raw data of all stored results
+     *
+     * @return Result data
+     */
+    std::vector<u8> readData() const;
+
+    /**
+     * @brief Writes the fingerprint, covered ranges, and result count to the index file
+     *
+     * @return true Index was written
+     * @return false Index could not be written
+     */
+    bool save() const;
+};
+
+#endif // SEARCHSTORE5_HPP
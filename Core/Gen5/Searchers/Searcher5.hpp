@@ -21,6 +21,7 @@
 #define SEARCHER5_HPP
 
 #include <Core/Gen5/Searchers/SearcherBase5.hpp>
+#include <Core/Gen5/Searchers/SeedHasher5.hpp>
 
 /**
  * @brief Parent searcher class for most Gen 5 generators
@@ -44,104 +45,39 @@ public:
 
 private:
     /**
-     * @brief Searches between the \p start and \p end dates
+     * @brief Searches a single tile of the search space
      *
-     * @param start Start date
-     * @param end End date
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param buffer Thread local buffer to store results in
      */
-    void search(const Date &start, const Date &end) override
+    void search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<State>> &buffer) override
     {
-#ifdef SIMD_X86
-        if (hasAVX2())
-        {
-            SHA1AVX2 sha(this->profile);
-            for (u16 timer0 = this->profile.getTimer0Min(); timer0 <= this->profile.getTimer0Max(); timer0++)
+        bool finished = SeedHasher5::hashDay(this->profile, timer0, date, keypress, [&](u32 time, const u64 *seeds, u8 count) {
+            if (!this->searching)
             {
-                sha.setTimer0(timer0, this->profile.getVCount());
-                for (Date date = start; date <= end; ++date)
-                {
-                    sha.setDate(date);
-                    auto alpha = sha.precompute();
-                    for (const auto &keypress : this->keypresses)
-                    {
-                        sha.setButton(keypress.value);
-
-                        for (u32 time = 0; time < 86400; time += 8)
-                        {
-                            if (!this->searching)
-                            {
-                                return;
-                            }
-
-                            sha.setTime(time, this->profile.getDSType());
-                            auto seeds = sha.hashSeed(alpha);
-
-                            for (u32 i = 0; i < seeds.size(); i++)
-                            {
-                                auto states = this->generator.generate(seeds[i]);
-                                if (!states.empty())
-                                {
-                                    DateTime dt(date, time + i);
-
-                                    std::lock_guard<std::mutex> lock(this->mutex);
-                                    this->results.reserve(this->results.capacity() + states.size());
-                                    for (const auto &state : states)
-                                    {
-                                        this->results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
-                                    }
-                                }
-                            }
-                        }
-                        this->progress++;
-                    }
-                }
+                return false;
             }
-        }
-        else
-#endif
-        {
-            SHA1SSE sha(this->profile);
-            for (u16 timer0 = this->profile.getTimer0Min(); timer0 <= this->profile.getTimer0Max(); timer0++)
+
+            for (u8 i = 0; i < count; i++)
             {
-                sha.setTimer0(timer0, this->profile.getVCount());
-                for (Date date = start; date <= end; ++date)
+                auto states = this->generator.generate(seeds[i]);
+                if (!states.empty())
                 {
-                    sha.setDate(date);
-                    auto alpha = sha.precompute();
-                    for (const auto &keypress : this->keypresses)
+                    DateTime dt(date, time + i);
+                    for (const auto &state : states)
                     {
-                        sha.setButton(keypress.value);
-
-                        for (u32 time = 0; time < 86400; time += 4)
-                        {
-                            if (!this->searching)
-                            {
-                                return;
-                            }
-
-                            sha.setTime(time, this->profile.getDSType());
-                            auto seeds = sha.hashSeed(alpha);
-
-                            for (u32 i = 0; i < seeds.size(); i++)
-                            {
-                                auto states = this->generator.generate(seeds[i]);
-                                if (!states.empty())
-                                {
-                                    DateTime dt(date, time + i);
-
-                                    std::lock_guard<std::mutex> lock(this->mutex);
-                                    this->results.reserve(this->results.capacity() + states.size());
-                                    for (const auto &state : states)
-                                    {
-                                        this->results.emplace_back(dt, seeds[i], keypress.button, timer0, state);
-                                    }
-                                }
-                            }
-                        }
-                        this->progress++;
+                        buffer.emplace_back(dt, seeds[i], keypress.button, timer0, state);
                     }
                 }
             }
+            return true;
+        });
+
+        if (finished)
+        {
+            this->progress++;
         }
     }
 };
@@ -22,10 +22,13 @@
 
 #include <Core/Gen5/Keypresses.hpp>
 #include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/Searchers/SearchShard5.hpp>
 #include <Core/Global.hpp>
 #include <Core/Parents/Searchers/SearcherBase.hpp>
+#include <Core/Parents/Searchers/TileScheduler.hpp>
 #include <Core/RNG/SHA1.hpp>
 #include <Core/Util/DateTime.hpp>
+#include <algorithm>
 #include <thread>
 
 class Date;
@@ -68,37 +71,77 @@ public:
     }
 
     /**
-     * @brief Starts the search
+     * @brief Computes max progress of a single shard
+     *
+     * @param shard Search shard
+     *
+     * @return Max progress
+     */
+    u64 getMaxProgress(const SearchShard5 &shard) const
+    {
+        return shard.buttons.size() * (shard.start.daysTo(shard.end) + 1) * (shard.timer0Max - shard.timer0Min + 1);
+    }
+
+    /**
+     * @brief Starts the search. The (timer0, date, keypress) space is split into tiles that are shared between the threads.
      *
      * @param threads Numbers of threads to search with
      * @param start Start date
      * @param end End date
      */
     void startSearch(int threads, const Date &start, const Date &end)
+    {
+        SearchShard5 shard = { start, end, {}, 0, profile.getTimer0Min(), profile.getTimer0Max() };
+        for (const auto &keypress : keypresses)
+        {
+            shard.buttons.emplace_back(keypress.button);
+        }
+        startSearch(threads, shard);
+    }
+
+    /**
+     * @brief Starts the search of a single shard. The (timer0, date, keypress) space of the shard is split into tiles that are shared
+     * between the threads.
+     *
+     * @param threads Numbers of threads to search with
+     * @param shard Search shard
+     */
+    void startSearch(int threads, const SearchShard5 &shard)
     {
         this->searching = true;
 
-        auto days = start.daysTo(end) + 1;
-        if (days < threads)
+        std::vector<Keypress> shardKeypresses;
+        for (Buttons button : shard.buttons)
         {
-            threads = days;
+            shardKeypresses.emplace_back(Keypress { Keypresses::getValue(button), button });
         }
 
+        u32 days = shard.start.daysTo(shard.end) + 1;
+        u64 tiles = static_cast<u64>(shardKeypresses.size()) * days * (shard.timer0Max - shard.timer0Min + 1);
+        // An empty search still needs one thread for the scheduler to split the tiles over
+        threads = static_cast<int>(std::max<u64>(1, std::min<u64>(tiles, threads)));
+
+        TileScheduler scheduler(tiles, threads);
         auto *threadContainer = new std::thread[threads];
 
-        auto daysSplit = days / threads;
-        Date day = start;
-        for (int i = 0; i < threads; i++, day += daysSplit)
+        for (int i = 0; i < threads; i++)
         {
-            if (i == threads - 1)
-            {
-                threadContainer[i] = std::thread([=] { search(day, end); });
-            }
-            else
-            {
-                Date mid = day + (daysSplit - 1);
-                threadContainer[i] = std::thread([=] { search(day, mid); });
-            }
+            threadContainer[i] = std::thread([this, &scheduler, &shard, &shardKeypresses, days, i] {
+                std::vector<SearcherState5<State>> buffer;
+
+                u64 tile;
+                while (this->searching && scheduler.next(i, tile))
+                {
+                    const auto &keypress = shardKeypresses[tile % shardKeypresses.size()];
+                    tile /= shardKeypresses.size();
+
+                    Date date = shard.start + static_cast<u32>(tile % days);
+                    tile /= days;
+
+                    search(shard.timer0Min + tile, date, keypress, buffer);
+                    this->pushResults(buffer);
+                }
+            });
         }
 
         for (int i = 0; i < threads; i++)
@@ -115,12 +158,14 @@ protected:
     std::vector<Keypress> keypresses;
 
     /**
-     * @brief Searches between the \p start and \p end dates
+     * @brief Searches a single tile of the search space
      *
-     * @param start Start date
-     * @param end End date
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param buffer Thread local buffer to store results in
      */
-    virtual void search(const Date &start, const Date &end) = 0;
+    virtual void search(u16 timer0, const Date &date, const Keypress &keypress, std::vector<SearcherState5<State>> &buffer) = 0;
 };
 
 #endif // SEARCHERBASE5_HPP
@@ -0,0 +1,79 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SeedHasher5.hpp"
+#include <Core/Gen5/Keypresses.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/RNG/SHA1.hpp>
+#include <Core/Util/DateTime.hpp>
+
+/**
+ * @brief Hashes the initial seed of every second of \p date
+ *
+ * @tparam SHA SIMD SHA1 class to hash with
+ * @param profile Profile information
+ * @param timer0 Timer0 value
+ * @param date Date value
+ * @param keypress Keypress value
+ * @param callback Called with the second of the first seed, the seeds, and the number of seeds of each batch
+ *
+ * @return true Every second was hashed
+ * @return false Hashing was stopped by \p callback
+ */
+template <class SHA>
+static bool hashDay(const Profile5 &profile, u16 timer0, const Date &date, const Keypress &keypress,
+                    const std::function<bool(u32, const u64 *, u8)> &callback)
+{
+    SHA sha(profile);
+    sha.setTimer0(timer0, profile.getVCount());
+    sha.setDate(date);
+    auto alpha = sha.precompute();
+    sha.setButton(keypress.value);
+
+    constexpr u8 lanes = sizeof(alpha[0]) / sizeof(u32);
+    for (u32 time = 0; time < 86400; time += lanes)
+    {
+        sha.setTime(time, profile.getDSType());
+        auto seeds = sha.hashSeed(alpha);
+        if (!callback(time, seeds.data(), lanes))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+namespace SeedHasher5
+{
+    bool hashDay(const Profile5 &profile, u16 timer0, const Date &date, const Keypress &keypress,
+                 const std::function<bool(u32, const u64 *, u8)> &callback)
+    {
+#ifdef SIMD_X86
+        if (hasAVX512())
+        {
+            return ::hashDay<SHA1AVX512>(profile, timer0, date, keypress, callback);
+        }
+        else if (hasAVX2())
+        {
+            return ::hashDay<SHA1AVX2>(profile, timer0, date, keypress, callback);
+        }
+#endif
+        return ::hashDay<SHA1SSE>(profile, timer0, date, keypress, callback);
+    }
+}
@@ -0,0 +1,50 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEEDHASHER5_HPP
+#define SEEDHASHER5_HPP
+
+#include <Core/Global.hpp>
+#include <functional>
+
+class Date;
+class Profile5;
+struct Keypress;
+
+namespace SeedHasher5
+{
+    /**
+     * @brief Hashes the initial seed of every second of \p date with the widest SHA1 the CPU supports. This is compiled as part of
+     * Core so searchers that are only instantiated outside of Core still get the AVX2/AVX512 hashing.
+     *
+     * @param profile Profile information
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param callback Called with the second of the first seed, the seeds, and the number of seeds of each batch. Returns false to
+     * stop hashing.
+     *
+     * @return true Every second was hashed
+     * @return false Hashing was stopped by \p callback
+     */
+    bool hashDay(const Profile5 &profile, u16 timer0, const Date &date, const Keypress &keypress,
+                 const std::function<bool(u32, const u64 *, u8)> &callback);
+}
+
+#endif // SEEDHASHER5_HPP
@@ -0,0 +1,270 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SeedTableSearcher.hpp"
+#include <Core/Enum/DSType.hpp>
+#include <Core/Enum/Game.hpp>
+#include <Core/Enum/Language.hpp>
+#include <Core/Parents/Searchers/TileScheduler.hpp>
+#include <Core/RNG/SHA1.hpp>
+#include <algorithm>
+#include <fstream>
+#include <queue>
+#include <thread>
+
+// Expected magic word is CRC32 of "SeedTable5"
+constexpr u32 MAGIC = 0xed3915ee;
+
+// Memory used to sort the table before it is spilled to disk
+constexpr u64 TABLE_BUDGET = 256 * 1024 * 1024;
+
+/**
+ * @brief Orders seed table records by seed, then by index
+ *
+ * @param left First record
+ * @param right Second record
+ *
+ * @return true \p left comes before \p right
+ * @return false \p left does not come before \p right
+ */
+static bool compareEntry(const SeedTableEntry &left, const SeedTableEntry &right)
+{
+    return left.seed != right.seed ? left.seed < right.seed : left.index < right.index;
+}
+
+template <typename Type>
+static void write(std::ostream &file, Type val)
+{
+    file.write(reinterpret_cast<char *>(&val), sizeof(val));
+}
+
+/**
+ * @brief Hashes every second of a day with the \p sha kernel and stores a record for each seed
+ *
+ * @tparam SHA SHA1 implementation
+ * @param sha SHA1 kernel with the Timer0 and date already set
+ * @param button Keypress value
+ * @param dsType DS type
+ * @param index Table index of the first second
+ * @param searching Whether the search is still running
+ * @param entries Records of the day
+ */
+template <class SHA>
+static void hashDay(SHA &sha, u32 button, DSType dsType, u32 index, const bool &searching, std::vector<SeedTableEntry> &entries)
+{
+    auto alpha = sha.precompute();
+    sha.setButton(button);
+    for (u32 time = 0; time < 86400;)
+    {
+        if (!searching)
+        {
+            return;
+        }
+
+        sha.setTime(time, dsType);
+        auto seeds = sha.hashSeed(alpha);
+        for (u64 seed : seeds)
+        {
+            entries.emplace_back(SeedTableEntry { static_cast<u32>(seed >> 32), index + time++ });
+        }
+    }
+}
+
+SeedTableSearcher::SeedTableSearcher(const Profile5 &profile, const Date &start, const Date &end) :
+    SearcherBase<SeedTableEntry>(),
+    profile(profile),
+    keypresses(Keypresses::getKeypresses(profile)),
+    end(end),
+    start(start)
+{
+}
+
+void SeedTableSearcher::startSearch(int threads)
+{
+    // Record indexes are 32 bits, so larger tables can not be built
+    if (SeedTable::getSize(profile, start, end) > SeedTable::maxSize)
+    {
+        return;
+    }
+
+    this->searching = true;
+
+    u32 days = start.daysTo(end) + 1;
+    u64 tiles = getMaxProgress();
+    // An empty search still needs one thread for the scheduler to split the tiles over
+    threads = static_cast<int>(std::max<u64>(1, std::min<u64>(tiles, threads)));
+
+    // Each thread sorts and spills its own part of the table, so no thread waits on another one writing to disk
+    tables.clear();
+    for (int i = 0; i < threads; i++)
+    {
+        tables.emplace_back(TABLE_BUDGET / threads, compareEntry);
+    }
+
+    TileScheduler scheduler(tiles, threads);
+    auto *threadContainer = new std::thread[threads];
+
+    for (int i = 0; i < threads; i++)
+    {
+        threadContainer[i] = std::thread([this, &scheduler, days, i] {
+            std::vector<SeedTableEntry> entries;
+            entries.reserve(86400);
+
+            u64 tile;
+            while (this->searching && scheduler.next(i, tile))
+            {
+                u32 keypress = tile % keypresses.size();
+                tile /= keypresses.size();
+
+                u32 day = tile % days;
+                u32 timer0 = tile / days;
+
+                // Records are indexed by day, then Timer0, then keypress, then second
+                u32 timer0Count = profile.getTimer0Max() - profile.getTimer0Min() + 1;
+                u32 index = ((day * timer0Count + timer0) * keypresses.size() + keypress) * 86400;
+
+                entries.clear();
+                search(profile.getTimer0Min() + timer0, start + day, keypresses[keypress], index, entries);
+
+                if (this->searching)
+                {
+                    tables[i].add(entries);
+                }
+                this->progress++;
+            }
+        });
+    }
+
+    for (int i = 0; i < threads; i++)
+    {
+        threadContainer[i].join();
+    }
+
+    delete[] threadContainer;
+}
+
+bool SeedTableSearcher::writeResults(std::string_view file)
+{
+    if (SeedTable::getSize(profile, start, end) > SeedTable::maxSize)
+    {
+        return false;
+    }
+
+    std::ofstream stream(file.data(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!stream.is_open())
+    {
+        return false;
+    }
+
+    u64 count = 0;
+    for (auto &table : tables)
+    {
+        table.finish();
+        count += table.size();
+    }
+
+    write(stream, MAGIC);
+
+    // Write profile data
+    write(stream, profile.getMac());
+    write(stream, end);
+    write(stream, start);
+    write(stream, profile.getVersion());
+    write(stream, profile.getTimer0Max());
+    write(stream, profile.getTimer0Min());
+    write(stream, profile.getDSType());
+    write(stream, profile.getLanguage());
+    write(stream, profile.getGxStat());
+    write(stream, profile.getVCount());
+    write(stream, profile.getVFrame());
+
+    write(stream, static_cast<u32>(keypresses.size()));
+    for (const auto &keypress : keypresses)
+    {
+        write(stream, keypress.button);
+    }
+
+    // Write the records followed by the first seed of each block
+    write(stream, count);
+
+    // Every record has a unique index, so merging the sorted tables of the threads gives the same order however the tiles were split
+    std::vector<u64> positions(tables.size(), 0);
+    auto after = [&](size_t left, size_t right) {
+        return compareEntry(tables[right].get(positions[right]), tables[left].get(positions[left]));
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(after)> queue(after);
+    for (size_t i = 0; i < tables.size(); i++)
+    {
+        if (tables[i].size() != 0)
+        {
+            queue.emplace(i);
+        }
+    }
+
+    std::vector<u32> blocks;
+    std::vector<SeedTableEntry> entries;
+    entries.reserve(SeedTable::blockSize);
+    for (u64 i = 0; i < count; i++)
+    {
+        size_t table = queue.top();
+        queue.pop();
+        entries.emplace_back(tables[table].get(positions[table]++));
+        if (positions[table] != tables[table].size())
+        {
+            queue.emplace(table);
+        }
+
+        if (entries.size() == SeedTable::blockSize || i + 1 == count)
+        {
+            blocks.emplace_back(entries.front().seed);
+            stream.write(reinterpret_cast<const char *>(entries.data()), entries.size() * sizeof(SeedTableEntry));
+            entries.clear();
+        }
+    }
+    stream.write(reinterpret_cast<const char *>(blocks.data()), blocks.size() * sizeof(u32));
+
+    return stream.good() && std::ranges::none_of(tables, [](const auto &table) { return table.failed(); });
+}
+
+void SeedTableSearcher::search(u16 timer0, const Date &date, const Keypress &keypress, u32 index, std::vector<SeedTableEntry> &entries)
+{
+#ifdef SIMD_X86
+    if (hasAVX512())
+    {
+        SHA1AVX512 sha(profile);
+        sha.setTimer0(timer0, profile.getVCount());
+        sha.setDate(date);
+        hashDay(sha, keypress.value, profile.getDSType(), index, this->searching, entries);
+    }
+    else if (hasAVX2())
+    {
+        SHA1AVX2 sha(profile);
+        sha.setTimer0(timer0, profile.getVCount());
+        sha.setDate(date);
+        hashDay(sha, keypress.value, profile.getDSType(), index, this->searching, entries);
+    }
+    else
+#endif
+    {
+        SHA1SSE sha(profile);
+        sha.setTimer0(timer0, profile.getVCount());
+        sha.setDate(date);
+        hashDay(sha, keypress.value, profile.getDSType(), index, this->searching, entries);
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEEDTABLESEARCHER_HPP
+#define SEEDTABLESEARCHER_HPP
+
+#include <Core/Gen5/Keypresses.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/Gen5/SeedTable.hpp>
+#include <Core/Parents/Searchers/ResultSpill.hpp>
+#include <Core/Parents/Searchers/SearcherBase.hpp>
+#include <Core/Util/DateTime.hpp>
+
+/**
+ * @brief Searcher class that builds a seed table. The table needs one record for every second, Timer0, and keypress of the date
+ * range. Ranges with more than \ref SeedTable::maxSize records are not searched and can not be written.
+ */
+class SeedTableSearcher final : public SearcherBase<SeedTableEntry>
+{
+public:
+    /**
+     * @brief Construct a new SeedTableSearcher object
+     *
+     * @param profile Profile information
+     * @param start Start date
+     * @param end End date
+     */
+    SeedTableSearcher(const Profile5 &profile, const Date &start, const Date &end);
+
+    /**
+     * @brief Computes max progress
+     *
+     * @return Max progress
+     */
+    u64 getMaxProgress() const
+    {
+        return keypresses.size() * (start.daysTo(end) + 1) * (profile.getTimer0Max() - profile.getTimer0Min() + 1);
+    }
+
+    /**
+     * @brief Starts the search
+     *
+     * @param threads Numbers of threads to search with
+     */
+    void startSearch(int threads);
+
+    /**
+     * @brief Writes the sorted table to file
+     *
+     * @param file Path to write the table to
+     *
+     * @return true Table was written
+     * @return false Table could not be written, the date range is too large, or a temporary file holding it failed
+     */
+    bool writeResults(std::string_view file);
+
+private:
+    Profile5 profile;
+    std::vector<ResultSpill<SeedTableEntry>> tables;
+    std::vector<Keypress> keypresses;
+    Date end;
+    Date start;
+
+    /**
+     * @brief Hashes every second of a single tile of the search space
+     *
+     * @param timer0 Timer0 value
+     * @param date Date value
+     * @param keypress Keypress value
+     * @param index Table index of the first second of the tile
+     * @param entries Records of the tile
+     */
+    void search(u16 timer0, const Date &date, const Keypress &keypress, u32 index, std::vector<SeedTableEntry> &entries);
+};
+
+#endif // SEEDTABLESEARCHER_HPP
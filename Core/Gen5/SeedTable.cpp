@@ -0,0 +1,157 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SeedTable.hpp"
+#include <Core/Gen5/Keypresses.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/RNG/SHA1.hpp>
+#include <algorithm>
+
+// Expected magic word is CRC32 of "SeedTable5"
+constexpr u32 MAGIC = 0xed3915ee;
+
+SeedTable::SeedTable(std::string_view path) : file(path.data(), std::ios_base::in | std::ios_base::binary), count(0), valid(false)
+{
+    if (file.is_open())
+    {
+        u32 magic;
+        file.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+        if (magic != MAGIC)
+        {
+            return;
+        }
+
+        file.read(reinterpret_cast<char *>(&mac), sizeof(mac));
+        file.read(reinterpret_cast<char *>(&end), sizeof(end));
+        file.read(reinterpret_cast<char *>(&start), sizeof(start));
+        file.read(reinterpret_cast<char *>(&version), sizeof(version));
+        file.read(reinterpret_cast<char *>(&timer0max), sizeof(timer0max));
+        file.read(reinterpret_cast<char *>(&timer0min), sizeof(timer0min));
+        file.read(reinterpret_cast<char *>(&type), sizeof(type));
+        file.read(reinterpret_cast<char *>(&language), sizeof(language));
+        file.read(reinterpret_cast<char *>(&gxstat), sizeof(gxstat));
+        file.read(reinterpret_cast<char *>(&vcount), sizeof(vcount));
+        file.read(reinterpret_cast<char *>(&vframe), sizeof(vframe));
+
+        u32 size;
+        file.read(reinterpret_cast<char *>(&size), sizeof(size));
+        buttons.resize(size);
+        file.read(reinterpret_cast<char *>(buttons.data()), size * sizeof(Buttons));
+
+        file.read(reinterpret_cast<char *>(&count), sizeof(count));
+        offset = file.tellg();
+
+        // The first seed of each block is stored after the records
+        blocks.resize((count + blockSize - 1) / blockSize);
+        file.seekg(offset + count * sizeof(SeedTableEntry));
+        file.read(reinterpret_cast<char *>(blocks.data()), blocks.size() * sizeof(u32));
+
+        valid = static_cast<bool>(file) && !buttons.empty() && start <= end;
+    }
+}
+
+std::vector<SeedTime5> SeedTable::find(u64 seed)
+{
+    std::vector<SeedTime5> results;
+    if (!valid)
+    {
+        return results;
+    }
+
+    // Matches can start in the block before the first block that begins with the seed
+    u32 key = seed >> 32;
+    auto it = std::lower_bound(blocks.begin(), blocks.end(), key);
+    u64 block = it == blocks.begin() ? 0 : std::distance(blocks.begin(), it) - 1;
+
+    SHA1 sha(version, language, type, mac, vframe, gxstat);
+    u32 timer0Count = timer0max - timer0min + 1;
+
+    std::vector<SeedTableEntry> entries(blockSize);
+    for (; block < blocks.size(); block++)
+    {
+        u64 first = block * blockSize;
+        u64 size = std::min<u64>(blockSize, count - first);
+
+        file.clear();
+        file.seekg(offset + first * sizeof(SeedTableEntry));
+        file.read(reinterpret_cast<char *>(entries.data()), size * sizeof(SeedTableEntry));
+        if (!file)
+        {
+            break;
+        }
+
+        auto begin = std::lower_bound(entries.begin(), entries.begin() + size, key,
+                                      [](const SeedTableEntry &entry, u32 key) { return entry.seed < key; });
+        auto last = std::upper_bound(begin, entries.begin() + size, key,
+                                     [](u32 key, const SeedTableEntry &entry) { return key < entry.seed; });
+        for (auto entry = begin; entry != last; entry++)
+        {
+            u32 index = entry->index;
+            u32 second = index % 86400;
+            index /= 86400;
+            Buttons button = buttons[index % buttons.size()];
+            index /= buttons.size();
+            u16 timer0 = timer0min + index % timer0Count;
+            Date date = start + index / timer0Count;
+
+            // The table only stores the upper half of the seed, so the lower half is checked by hashing again
+            sha.setTimer0(timer0, vcount);
+            sha.setDate(date);
+            auto alpha = sha.precompute();
+            sha.setButton(Keypresses::getValue(button));
+            sha.setTime(second, type);
+            if (sha.hashSeed(alpha) == seed)
+            {
+                results.emplace_back(DateTime(date, second), seed, button, timer0);
+            }
+        }
+
+        if (last != entries.begin() + size)
+        {
+            break;
+        }
+    }
+
+    return results;
+}
+
+u64 SeedTable::getSize(const Profile5 &profile, const Date &start, const Date &end)
+{
+    return Keypresses::getKeypresses(profile).size() * (start.daysTo(end) + 1) * (profile.getTimer0Max() - profile.getTimer0Min() + 1)
+        * 86400ULL;
+}
+
+bool SeedTable::isValid() const
+{
+    return valid;
+}
+
+bool SeedTable::isValid(const Profile5 &profile) const
+{
+    if (!valid || mac != profile.getMac() || version != profile.getVersion() || timer0max != profile.getTimer0Max()
+        || timer0min != profile.getTimer0Min() || type != profile.getDSType() || language != profile.getLanguage()
+        || gxstat != profile.getGxStat() || vcount != profile.getVCount() || vframe != profile.getVFrame())
+    {
+        return false;
+    }
+
+    auto keypresses = Keypresses::getKeypresses(profile);
+    return std::equal(keypresses.begin(), keypresses.end(), buttons.begin(), buttons.end(),
+                      [](const Keypress &keypress, Buttons button) { return keypress.button == button; });
+}
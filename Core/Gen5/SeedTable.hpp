@@ -0,0 +1,207 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEEDTABLE_HPP
+#define SEEDTABLE_HPP
+
+#include <Core/Global.hpp>
+#include <Core/Util/DateTime.hpp>
+#include <fstream>
+#include <string_view>
+#include <vector>
+
+class Profile5;
+enum class Buttons : u16;
+enum class DSType : u8;
+enum class Game : u32;
+enum class Language : u8;
+
+/**
+ * @brief Record of the seed table. Stores the upper 32 bits of a seed and the index of the date, second, Timer0, and keypress that
+ * hash to it.
+ */
+struct SeedTableEntry
+{
+    u32 seed;
+    u32 index;
+};
+
+/**
+ * @brief State class for seed to date/time Gen 5
+ */
+class SeedTime5
+{
+public:
+    /**
+     * @brief Construct a new SeedTime5 object
+     *
+     * @param dateTime Date/time
+     * @param initialSeed Initial seed
+     * @param buttons Key presses
+     * @param timer0 Timer0
+     */
+    SeedTime5(const DateTime &dateTime, u64 initialSeed, Buttons buttons, u16 timer0) :
+        initialSeed(initialSeed), dateTime(dateTime), buttons(buttons), timer0(timer0)
+    {
+    }
+
+    /**
+     * @brief Returns the key presses
+     *
+     * @return Key presses
+     */
+    Buttons getButtons() const
+    {
+        return buttons;
+    }
+
+    /**
+     * @brief Returns the date/time
+     *
+     * @return Date/time
+     */
+    DateTime getDateTime() const
+    {
+        return dateTime;
+    }
+
+    /**
+     * @brief Returns the initial seed
+     *
+     * @return Initial seed
+     */
+    u64 getInitialSeed() const
+    {
+        return initialSeed;
+    }
+
+    /**
+     * @brief Returns the Timer0
+     *
+     * @return Timer0
+     */
+    u16 getTimer0() const
+    {
+        return timer0;
+    }
+
+private:
+    u64 initialSeed;
+    DateTime dateTime;
+    Buttons buttons;
+    u16 timer0;
+};
+
+/**
+ * @brief Table of every seed a profile hashes to over a date range, sorted by the upper 32 bits of the seed.
+ * Only the first seed of each block of records is kept in memory, so a lookup reads a single block from the file.
+ */
+class SeedTable
+{
+public:
+    /**
+     * @brief Number of records in a block of the table
+     */
+    static constexpr u32 blockSize = 4096;
+
+    /**
+     * @brief Maximum number of records in a table, as each record stores its index in 32 bits
+     */
+    static constexpr u64 maxSize = 0x100000000;
+
+    /**
+     * @brief Construct a new SeedTable object
+     *
+     * @param path Path to file to read the table from
+     */
+    SeedTable(std::string_view path);
+
+    /**
+     * @brief Finds the date/times, Timer0 values, and keypresses that hash to the \p seed
+     *
+     * @param seed Initial seed
+     *
+     * @return Matching date/times
+     */
+    std::vector<SeedTime5> find(u64 seed);
+
+    /**
+     * @brief Returns the end date
+     *
+     * @return End date
+     */
+    Date getEndDate() const
+    {
+        return end;
+    }
+
+    /**
+     * @brief Returns the number of records in a table of the \p profile from \p start to \p end
+     *
+     * @param profile Profile information
+     * @param start Start date
+     * @param end End date
+     *
+     * @return Number of records
+     */
+    static u64 getSize(const Profile5 &profile, const Date &start, const Date &end);
+
+    /**
+     * @brief Returns the start date
+     *
+     * @return Start date
+     */
+    Date getStartDate() const
+    {
+        return start;
+    }
+
+    /**
+     * @brief Determines if table is valid
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Determines table was created from the given \p profile
+     *
+     * @param profile Profile information
+     */
+    bool isValid(const Profile5 &profile) const;
+
+private:
+    std::ifstream file;
+    std::vector<Buttons> buttons;
+    std::vector<u32> blocks;
+    u64 count;
+    u64 mac;
+    u64 offset;
+    Date end;
+    Date start;
+    Game version;
+    u16 timer0max;
+    u16 timer0min;
+    DSType type;
+    Language language;
+    bool valid;
+    u8 gxstat;
+    u8 vcount;
+    u8 vframe;
+};
+
+#endif // SEEDTABLE_HPP
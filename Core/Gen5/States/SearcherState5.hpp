@@ -22,6 +22,7 @@
 
 #include <Core/Global.hpp>
 #include <Core/Util/DateTime.hpp>
+#include <tuple>
 
 enum class Buttons : u16;
 
@@ -48,6 +49,25 @@ public:
     {
     }
 
+    /**
+     * @brief Orders states by date/time, Timer0, and key presses
+     *
+     * @param left First state
+     * @param right Second state
+     *
+     * @return true \p left comes before \p right
+     * @return false \p left does not come before \p right
+     */
+    static bool compare(const SearcherState5 &left, const SearcherState5 &right)
+    {
+        if (!(left.dt == right.dt))
+        {
+            return left.dt < right.dt;
+        }
+        return std::make_tuple(left.timer0, static_cast<u16>(left.buttons))
+            < std::make_tuple(right.timer0, static_cast<u16>(right.buttons));
+    }
+
     /**
      * @brief Returns the key presses of the state
      *
@@ -26,30 +26,67 @@
 #include <Core/Util/Translator.hpp>
 #include <Core/Util/Utilities.hpp>
 
-static std::array<u8, 6> generateMTIVs(u64 seed, Game version, u32 ivAdvance, bool roamer)
+/**
+ * @brief Hashes the seed of every second/Timer0 combination. The seconds are split across the lanes of \p SHA.
+ *
+ * @tparam SHA SHA1 implementation
+ * @tparam lanes Number of seeds hashed at once
+ * @param dateTimes Date/time of each second
+ * @param buttons Current button presses
+ * @param profile Profile information
+ * @param seeds Seed of each combination, ordered by second and then Timer0
+ * @param advances Initial advances of each combination
+ */
+template <class SHA, int lanes>
+static void hashSeeds(const std::vector<DateTime> &dateTimes, Buttons buttons, const Profile5 &profile, std::vector<u64> &seeds,
+                      std::vector<u32> &advances)
 {
-    bool bw = (version & Game::BW) != Game::None;
-    MT rng(seed >> 32, ivAdvance + (bw ? 0 : 2) + (roamer ? 1 : 0));
+    u32 timer0Min = profile.getTimer0Min();
+    u32 timer0Count = profile.getTimer0Max() - timer0Min + 1;
 
-    std::array<u8, 6> ivs;
-    ivs[0] = rng.next() >> 27;
-    ivs[1] = rng.next() >> 27;
-    ivs[2] = rng.next() >> 27;
+    SHA sha(profile);
+    sha.setButton(Keypresses::getValue(buttons));
 
-    if (roamer)
+    std::array<u32, lanes> times;
+    for (size_t start = 0; start < dateTimes.size();)
     {
-        ivs[4] = rng.next() >> 27;
-        ivs[5] = rng.next() >> 27;
-        ivs[3] = rng.next() >> 27;
-    }
-    else
-    {
-        ivs[3] = rng.next() >> 27;
-        ivs[4] = rng.next() >> 27;
-        ivs[5] = rng.next() >> 27;
-    }
+        // Every lane has to share the same date
+        Date date = dateTimes[start].getDate();
+
+        u8 count = 0;
+        for (; count < lanes && start + count < dateTimes.size() && dateTimes[start + count].getDate() == date; count++)
+        {
+            Time time = dateTimes[start + count].getTime();
+            times[count] = time.hour() * 3600 + time.minute() * 60 + time.second();
+        }
+
+        // Repeat the last second in unused lanes
+        for (u8 i = count; i < lanes; i++)
+        {
+            times[i] = times[count - 1];
+        }
+
+        sha.setDate(date);
+        sha.setTime(times, profile.getDSType());
+        for (u32 timer0 = 0; timer0 < timer0Count; timer0++)
+        {
+            sha.setTimer0(timer0Min + timer0, profile.getVCount());
+            auto alpha = sha.precompute();
+            auto hashes = sha.hashSeed(alpha);
+
+            std::array<u32, lanes> initialAdvances;
+            Utilities5::initialAdvances(hashes.data(), count, profile, initialAdvances.data());
+
+            for (u8 i = 0; i < count; i++)
+            {
+                size_t index = (start + i) * timer0Count + timer0;
+                seeds[index] = hashes[i];
+                advances[index] = initialAdvances[i];
+            }
+        }
 
-    return ivs;
+        start += count;
+    }
 }
 
 namespace AdjacentSeedsCalculator
@@ -60,43 +97,73 @@ namespace AdjacentSeedsCalculator
         u32 timer0Min = profile.getTimer0Min();
         u32 timer0Max = profile.getTimer0Max();
 
-        u32 rangeSeconds = seconds * 2 + 1;
         u32 timer0Count = timer0Max - timer0Min + 1;
         u32 ivCount = maxIVAdvance - minIVAdvance + 1;
 
-        SHA1 sha(profile);
-        sha.setButton(Keypresses::getValue(buttons));
-
-        std::vector<AdjacentSeedsState> states;
-        states.reserve(rangeSeconds * timer0Count * ivCount);
-
+        std::vector<DateTime> dateTimes;
         for (int secondOffset = -seconds; secondOffset <= seconds; secondOffset++)
         {
             DateTime offset = dateTime.addSeconds(secondOffset);
-            if (!offset.valid())
+            if (offset.valid())
             {
-                continue;
+                dateTimes.emplace_back(offset);
             }
+        }
 
-            Date date = offset.getDate();
-            Time time = offset.getTime();
+        std::vector<u64> seeds(dateTimes.size() * timer0Count);
+        std::vector<u32> advances(dateTimes.size() * timer0Count);
+#ifdef SIMD_X86
+        if (hasAVX512())
+        {
+            hashSeeds<SHA1AVX512, 16>(dateTimes, buttons, profile, seeds, advances);
+        }
+        else if (hasAVX2())
+        {
+            hashSeeds<SHA1AVX2, 8>(dateTimes, buttons, profile, seeds, advances);
+        }
+        else
+#endif
+        {
+            hashSeeds<SHA1SSE, 4>(dateTimes, buttons, profile, seeds, advances);
+        }
+
+        bool bw = (profile.getVersion() & Game::BW) != Game::None;
+        u32 offset = (bw ? 0 : 2) + (roamer ? 1 : 0);
 
-            sha.setDate(date);
-            sha.setTime(time.hour(), time.minute(), time.second(), profile.getDSType());
+        std::vector<AdjacentSeedsState> states;
+        states.reserve(seeds.size() * ivCount);
 
-            for (u32 timer0 = timer0Min; timer0 <= timer0Max; timer0++)
+        // Each IV advance only shifts the window of IVs by one, so the IVs of every advance come from one MT stream
+        std::vector<u8> rolls(ivCount + 5);
+        for (size_t i = 0; i < dateTimes.size(); i++)
+        {
+            for (u32 timer0 = 0; timer0 < timer0Count; timer0++)
             {
-                sha.setTimer0(timer0, profile.getVCount());
-                auto alpha = sha.precompute();
-                u64 seed = sha.hashSeed(alpha);
+                size_t index = i * timer0Count + timer0;
+                u64 seed = seeds[index];
 
-                for (u32 ivAdvance = minIVAdvance; ivAdvance <= maxIVAdvance; ivAdvance++)
+                MT rng(seed >> 32, minIVAdvance + offset);
+                for (u8 &roll : rolls)
                 {
-                    std::array<u8, 6> ivs = generateMTIVs(seed, profile.getVersion(), ivAdvance, roamer);
+                    roll = rng.next() >> 27;
+                }
 
-                    states.emplace_back(seed, offset, buttons, static_cast<u16>(timer0), ivAdvance, ivs,
-                                        Utilities5::initialAdvances(seed, profile),
-                                        offset == dateTime && timer0 == profile.getTimer0Min() && ivAdvance == minIVAdvance);
+                for (u32 ivAdvance = 0; ivAdvance < ivCount; ivAdvance++)
+                {
+                    const u8 *roll = &rolls[ivAdvance];
+
+                    std::array<u8, 6> ivs;
+                    if (roamer)
+                    {
+                        ivs = { roll[0], roll[1], roll[2], roll[5], roll[3], roll[4] };
+                    }
+                    else
+                    {
+                        ivs = { roll[0], roll[1], roll[2], roll[3], roll[4], roll[5] };
+                    }
+
+                    states.emplace_back(seed, dateTimes[i], buttons, static_cast<u16>(timer0Min + timer0), minIVAdvance + ivAdvance, ivs,
+                                        advances[index], dateTimes[i] == dateTime && timer0 == 0 && ivAdvance == 0);
                 }
             }
         }
@@ -401,6 +401,12 @@ namespace ProfileLoader5
         writeJson(j);
     }
 
+    Profile5 fromJson(const std::string &data)
+    {
+        json j = json::parse(data, nullptr, false);
+        return getProfile(j.is_object() ? j : json::object());
+    }
+
     std::vector<Profile5> getProfiles(Game version)
     {
         json j = readJson();
@@ -443,6 +449,11 @@ namespace ProfileLoader5
             }
         }
     }
+
+    std::string toJson(const Profile5 &profile)
+    {
+        return getJson(profile).dump();
+    }
 }
 
 namespace ProfileLoader8
@@ -120,6 +120,15 @@ namespace ProfileLoader5
      */
     void addProfile(const Profile5 &profile);
 
+    /**
+     * @brief Converts json text in the stored profile format to a profile
+     *
+     * @param data json text
+     *
+     * @return Converted profile
+     */
+    Profile5 fromJson(const std::string &data);
+
     /**
      * @brief Reads profiles from stored json file
      *
@@ -143,6 +152,15 @@ namespace ProfileLoader5
      * @param original Profile being edited
      */
     void updateProfile(const Profile5 &update, const Profile5 &original);
+
+    /**
+     * @brief Converts a profile to json text in the stored profile format
+     *
+     * @param profile Profile to convert
+     *
+     * @return json text
+     */
+    std::string toJson(const Profile5 &profile);
 }
 
 namespace ProfileLoader8
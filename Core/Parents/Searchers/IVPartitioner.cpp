@@ -0,0 +1,86 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IVPartitioner.hpp"
+#include <algorithm>
+
+// Number of work units per thread. More units keep the threads balanced when the
+// time per IV combination varies, at the cost of more scheduling.
+constexpr u64 unitsPerThread = 64;
+
+IVPartitioner::IVPartitioner(const std::array<u8, 6> &min, const std::array<u8, 6> &max, int threads) :
+    combinations(1), unitSize(0), units(0), max(max), min(min)
+{
+    for (u8 i = 0; i < 6; i++)
+    {
+        if (min[i] > max[i])
+        {
+            combinations = 0;
+            return;
+        }
+        combinations *= max[i] - min[i] + 1;
+    }
+
+    u64 target = std::max(threads, 1) * unitsPerThread;
+    unitSize = (combinations + target - 1) / target;
+    units = (combinations + unitSize - 1) / unitSize;
+}
+
+u64 IVPartitioner::getCombinations() const
+{
+    return combinations;
+}
+
+std::array<u8, 6> IVPartitioner::getIVs(u64 unit) const
+{
+    u64 index = unit * unitSize;
+
+    std::array<u8, 6> ivs;
+    for (int i = 5; i >= 0; i--)
+    {
+        u32 range = max[i] - min[i] + 1;
+        ivs[i] = min[i] + index % range;
+        index /= range;
+    }
+    return ivs;
+}
+
+u64 IVPartitioner::getSize(u64 unit) const
+{
+    u64 begin = unit * unitSize;
+    return std::min(unitSize, combinations - begin);
+}
+
+u64 IVPartitioner::getUnits() const
+{
+    return units;
+}
+
+void IVPartitioner::next(std::array<u8, 6> &ivs) const
+{
+    for (int i = 5; i >= 0; i--)
+    {
+        if (ivs[i] < max[i])
+        {
+            ivs[i]++;
+            return;
+        }
+        ivs[i] = min[i];
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef IVPARTITIONER_HPP
+#define IVPARTITIONER_HPP
+
+#include <Core/Global.hpp>
+#include <array>
+
+/**
+ * @brief Splits the six dimensional IV box of a searcher into balanced work units. The IV combinations are numbered in the order of
+ * the nested HP to Spe loops and each work unit is a contiguous range of them, so handling the units in order keeps that order.
+ */
+class IVPartitioner
+{
+public:
+    /**
+     * @brief Construct a new IVPartitioner object
+     *
+     * @param min Minimum IVs
+     * @param max Maximum IVs
+     * @param threads Number of threads the units are shared between
+     */
+    IVPartitioner(const std::array<u8, 6> &min, const std::array<u8, 6> &max, int threads);
+
+    /**
+     * @brief Returns the number of IV combinations
+     *
+     * @return IV combination count
+     */
+    u64 getCombinations() const;
+
+    /**
+     * @brief Returns the first IV combination of \p unit
+     *
+     * @param unit Work unit index
+     *
+     * @return IVs
+     */
+    std::array<u8, 6> getIVs(u64 unit) const;
+
+    /**
+     * @brief Returns the number of IV combinations in \p unit
+     *
+     * @param unit Work unit index
+     *
+     * @return IV combination count
+     */
+    u64 getSize(u64 unit) const;
+
+    /**
+     * @brief Returns the number of work units
+     *
+     * @return Work unit count
+     */
+    u64 getUnits() const;
+
+    /**
+     * @brief Moves \p ivs to the next IV combination in loop order
+     *
+     * @param ivs IVs to update
+     */
+    void next(std::array<u8, 6> &ivs) const;
+
+private:
+    u64 combinations;
+    u64 unitSize;
+    u64 units;
+    std::array<u8, 6> max;
+    std::array<u8, 6> min;
+};
+
+#endif // IVPARTITIONER_HPP
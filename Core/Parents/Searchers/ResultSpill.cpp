@@ -0,0 +1,72 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "ResultSpill.hpp"
+#include <filesystem>
+#include <random>
+#include <sstream>
+
+TemporaryFile::TemporaryFile()
+{
+    // Without a temporary directory the file is left closed, so every read and write fails
+    std::error_code error;
+    std::filesystem::path directory = std::filesystem::temp_directory_path(error);
+    if (error)
+    {
+        return;
+    }
+
+    std::random_device device;
+    do
+    {
+        std::stringstream name;
+        name << "PokeFinder-" << std::hex << device() << device() << ".tmp";
+        path = (directory / name.str()).string();
+    } while (std::filesystem::exists(path));
+
+    file.open(path, std::ios_base::in | std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+}
+
+TemporaryFile::~TemporaryFile()
+{
+    file.close();
+
+    if (!path.empty())
+    {
+        std::error_code error;
+        std::filesystem::remove(path, error);
+    }
+}
+
+bool TemporaryFile::read(u64 offset, void *data, u64 size)
+{
+    file.clear();
+    file.seekg(offset);
+    file.read(reinterpret_cast<char *>(data), size);
+    return file.good() && static_cast<u64>(file.gcount()) == size;
+}
+
+bool TemporaryFile::write(u64 offset, const void *data, u64 size)
+{
+    file.clear();
+    file.seekp(offset);
+    file.write(reinterpret_cast<const char *>(data), size);
+    file.flush();
+    return file.good();
+}
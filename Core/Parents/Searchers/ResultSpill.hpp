@@ -0,0 +1,391 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RESULTSPILL_HPP
+#define RESULTSPILL_HPP
+
+#include <Core/Global.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Binary file in the temporary directory that is removed when the object is destroyed
+ */
+class TemporaryFile
+{
+public:
+    /**
+     * @brief Construct a new TemporaryFile object with a unique name
+     */
+    TemporaryFile();
+
+    /**
+     * @brief Destroy the TemporaryFile object and remove the file
+     */
+    ~TemporaryFile();
+
+    /**
+     * @brief Reads \p size bytes at \p offset
+     *
+     * @param offset Byte offset
+     * @param data Destination of the bytes
+     * @param size Number of bytes
+     *
+     * @return true All bytes were read
+     * @return false The file could not be read
+     */
+    bool read(u64 offset, void *data, u64 size);
+
+    /**
+     * @brief Writes \p size bytes at \p offset
+     *
+     * @param offset Byte offset
+     * @param data Bytes to write
+     * @param size Number of bytes
+     *
+     * @return true All bytes were written
+     * @return false The file could not be written
+     */
+    bool write(u64 offset, const void *data, u64 size);
+
+private:
+    std::fstream file;
+    std::string path;
+};
+
+/**
+ * @brief Stores search results in memory until they exceed a memory budget. Past that point the results are written to a temporary
+ * file as fixed-size runs, which are sorted if a comparison is given. \ref finish() merges the runs so the results are in order,
+ * and results are read back one page at a time. A failed read or write of the temporary file is reported by \ref failed().
+ *
+ * @tparam Result Result type, which has to be trivially copyable
+ */
+template <class Result>
+class ResultSpill
+{
+    static_assert(std::is_trivially_copyable_v<Result>, "Result has to be trivially copyable to be spilled");
+
+public:
+    using Compare = bool (*)(const Result &, const Result &);
+
+    /**
+     * @brief Construct a new ResultSpill object
+     *
+     * @param budget Number of bytes of results kept in memory
+     * @param compare Ordering of the results, or nullptr to keep the order they were added in
+     */
+    ResultSpill(u64 budget, Compare compare = nullptr) :
+        compare(compare), runSize(std::max<u64>(budget / sizeof(Result), pageSize)), spilled(0), pageStart(0), error(false)
+    {
+    }
+
+    /**
+     * @brief Adds \p results after the existing results. Once the in-memory results reach the budget they are written to the
+     * temporary file.
+     *
+     * @param results Results to add
+     */
+    void add(const std::vector<Result> &results)
+    {
+        auto it = results.begin();
+        while (it != results.end())
+        {
+            u64 count = std::min<u64>(runSize - buffer.size(), results.end() - it);
+            buffer.insert(buffer.end(), it, it + count);
+            it += count;
+
+            if (buffer.size() == runSize)
+            {
+                spill();
+            }
+        }
+    }
+
+    /**
+     * @brief Removes all results and the temporary file
+     */
+    void clear()
+    {
+        buffer.clear();
+        buffer.shrink_to_fit();
+        page.clear();
+        page.shrink_to_fit();
+        runs.clear();
+        file.reset();
+        spilled = 0;
+        pageStart = 0;
+        error = false;
+    }
+
+    /**
+     * @brief Puts the results in order once all results have been added. Results added afterwards are not ordered until the next
+     * call.
+     */
+    void finish()
+    {
+        if (!file)
+        {
+            if (compare)
+            {
+                std::stable_sort(buffer.begin(), buffer.end(), compare);
+            }
+            return;
+        }
+
+        if (!buffer.empty())
+        {
+            spill();
+        }
+
+        if (compare && runs.size() > 1)
+        {
+            merge();
+        }
+    }
+
+    /**
+     * @brief Returns if reading or writing the temporary file failed. Results that could not be read back are zeroed.
+     *
+     * @return true Temporary file failed
+     * @return false Temporary file is intact
+     */
+    bool failed() const
+    {
+        return error;
+    }
+
+    /**
+     * @brief Returns the result at \p index. Results in the temporary file are read one page at a time.
+     *
+     * @param index Result index
+     *
+     * @return Result
+     */
+    Result get(u64 index) const
+    {
+        if (index >= spilled)
+        {
+            return buffer[index - spilled];
+        }
+
+        if (index < pageStart || index >= pageStart + page.size())
+        {
+            pageStart = index - (index % pageSize);
+            page.clear();
+            read(pageStart, std::min<u64>(pageSize, spilled - pageStart), page);
+        }
+        return page[index - pageStart];
+    }
+
+    /**
+     * @brief Returns if any results have been written to the temporary file
+     *
+     * @return true Results were spilled
+     * @return false All results are in memory
+     */
+    bool isSpilled() const
+    {
+        return spilled != 0;
+    }
+
+    /**
+     * @brief Returns the number of results
+     *
+     * @return Number of results
+     */
+    u64 size() const
+    {
+        return spilled + buffer.size();
+    }
+
+    /**
+     * @brief Returns if adding \p count results writes to the temporary file for the first time
+     *
+     * @param count Number of results to add
+     *
+     * @return true Adding the results spills
+     * @return false Results stay in memory or were already spilled
+     */
+    bool willSpill(u64 count) const
+    {
+        return !isSpilled() && buffer.size() + count >= runSize;
+    }
+
+private:
+    static constexpr u64 pageSize = 4096;
+
+    std::unique_ptr<TemporaryFile> file;
+    std::vector<Result> buffer;
+    std::vector<u64> runs;
+    mutable std::vector<Result> page;
+    Compare compare;
+    u64 runSize;
+    u64 spilled;
+    mutable u64 pageStart;
+    mutable bool error;
+
+    /**
+     * @brief Merges the sorted runs into a new temporary file. Ties are taken from the earlier run, so the merge is stable.
+     */
+    void merge()
+    {
+        struct Cursor
+        {
+            std::vector<Result> data;
+            u64 index;
+            u64 end;
+            size_t position;
+        };
+
+        // Split the budget between a read block for each run and the output block
+        u64 block = std::max<u64>(runSize / (runs.size() + 1), 1);
+
+        std::vector<Cursor> cursors(runs.size());
+        for (size_t i = 0; i < runs.size(); i++)
+        {
+            Cursor &cursor = cursors[i];
+            cursor.index = runs[i];
+            cursor.end = i + 1 < runs.size() ? runs[i + 1] : spilled;
+            cursor.position = 0;
+            cursor.data.reserve(block);
+        }
+
+        auto load = [&](Cursor &cursor) {
+            u64 count = std::min(block, cursor.end - cursor.index);
+            cursor.data.clear();
+            cursor.position = 0;
+            read(cursor.index, count, cursor.data);
+            cursor.index += count;
+        };
+
+        auto after = [&](size_t left, size_t right) {
+            const Result &l = cursors[left].data[cursors[left].position];
+            const Result &r = cursors[right].data[cursors[right].position];
+            if (compare(r, l))
+            {
+                return true;
+            }
+            if (compare(l, r))
+            {
+                return false;
+            }
+            return left > right;
+        };
+
+        std::priority_queue<size_t, std::vector<size_t>, decltype(after)> queue(after);
+        for (size_t i = 0; i < cursors.size(); i++)
+        {
+            load(cursors[i]);
+            queue.emplace(i);
+        }
+
+        auto output = std::make_unique<TemporaryFile>();
+        std::vector<Result> out;
+        out.reserve(block);
+        u64 written = 0;
+
+        while (!queue.empty())
+        {
+            size_t i = queue.top();
+            queue.pop();
+
+            Cursor &cursor = cursors[i];
+            out.emplace_back(cursor.data[cursor.position++]);
+            if (out.size() == block)
+            {
+                error |= !output->write(written * sizeof(Result), out.data(), out.size() * sizeof(Result));
+                written += out.size();
+                out.clear();
+            }
+
+            if (cursor.position == cursor.data.size())
+            {
+                if (cursor.index == cursor.end)
+                {
+                    std::vector<Result>().swap(cursor.data);
+                    continue;
+                }
+                load(cursor);
+            }
+            queue.emplace(i);
+        }
+
+        error |= !output->write(written * sizeof(Result), out.data(), out.size() * sizeof(Result));
+
+        file = std::move(output);
+        runs = { 0 };
+        page.clear();
+        pageStart = 0;
+    }
+
+    /**
+     * @brief Reads \p count results starting at \p index from the temporary file
+     *
+     * @param index Result index
+     * @param count Number of results
+     * @param results Vector the results are appended to
+     */
+    void read(u64 index, u64 count, std::vector<Result> &results) const
+    {
+        std::vector<u8> data(count * sizeof(Result));
+        if (!file->read(index * sizeof(Result), data.data(), data.size()))
+        {
+            std::fill(data.begin(), data.end(), 0);
+            error = true;
+        }
+
+        std::array<u8, sizeof(Result)> raw;
+        for (u64 i = 0; i < count; i++)
+        {
+            std::memcpy(raw.data(), data.data() + i * sizeof(Result), sizeof(Result));
+            results.emplace_back(std::bit_cast<Result>(raw));
+        }
+    }
+
+    /**
+     * @brief Writes the in-memory results to the temporary file as a new run
+     */
+    void spill()
+    {
+        if (!file)
+        {
+            file = std::make_unique<TemporaryFile>();
+        }
+
+        if (compare)
+        {
+            std::stable_sort(buffer.begin(), buffer.end(), compare);
+        }
+
+        error |= !file->write(spilled * sizeof(Result), buffer.data(), buffer.size() * sizeof(Result));
+        runs.emplace_back(spilled);
+        spilled += buffer.size();
+        buffer.clear();
+    }
+};
+
+#endif // RESULTSPILL_HPP
@@ -0,0 +1,299 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SearchCheckpoint.hpp"
+#include <array>
+#include <filesystem>
+
+// Expected magic word is CRC32 of "SearchCheckpointV2"
+constexpr u32 MAGIC = 0x5cd31e8c;
+
+constexpr auto CRC_TABLE = [] {
+    std::array<u32, 256> table {};
+    for (u32 i = 0; i < 256; i++)
+    {
+        u32 crc = i;
+        for (int j = 0; j < 8; j++)
+        {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xedb88320 : 0);
+        }
+        table[i] = crc;
+    }
+    return table;
+}();
+
+/**
+ * @brief Continues the CRC32 of a record with \p length bytes of \p data
+ *
+ * @param crc CRC32 of the previous bytes of the record
+ * @param data Data to add
+ * @param length Number of bytes
+ *
+ * @return Updated CRC32
+ */
+static u32 crc32(u32 crc, const void *data, u64 length)
+{
+    const u8 *ptr = reinterpret_cast<const u8 *>(data);
+    crc = ~crc;
+    for (u64 i = 0; i < length; i++)
+    {
+        crc = CRC_TABLE[(crc ^ ptr[i]) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Computes the CRC32 of a record
+ *
+ * @param tile Tile index
+ * @param counts Number of results of each list
+ * @param data Result data of all lists
+ *
+ * @return CRC32 of the record
+ */
+static u32 recordCRC(u64 tile, const std::vector<u32> &counts, const std::vector<u8> &data)
+{
+    u32 crc = crc32(0, &tile, sizeof(tile));
+    crc = crc32(crc, counts.data(), counts.size() * sizeof(u32));
+    return crc32(crc, data.data(), data.size());
+}
+
+SearchCheckpoint::SearchCheckpoint(std::string_view path, const std::string &parameters, u64 tiles, u32 lists, u32 size) :
+    path(path), offsets(tiles), totals(lists), completed(0), end(0), lists(lists), size(size), error(false)
+{
+    if (!open(parameters))
+    {
+        std::ofstream stream(this->path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+        u32 magic = MAGIC;
+        u32 length = parameters.size();
+        stream.write(reinterpret_cast<const char *>(&magic), sizeof(magic));
+        stream.write(reinterpret_cast<const char *>(&length), sizeof(length));
+        stream.write(parameters.data(), parameters.size());
+        stream.write(reinterpret_cast<const char *>(&tiles), sizeof(tiles));
+        stream.write(reinterpret_cast<const char *>(&lists), sizeof(lists));
+        stream.write(reinterpret_cast<const char *>(&size), sizeof(size));
+        stream.close();
+
+        end = sizeof(magic) + sizeof(length) + parameters.size() + sizeof(tiles) + sizeof(lists) + sizeof(size);
+        error = !stream;
+    }
+
+    file.open(this->path, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    if (!file.is_open())
+    {
+        error = true;
+    }
+}
+
+bool SearchCheckpoint::failed() const
+{
+    return error;
+}
+
+u64 SearchCheckpoint::getCompleted() const
+{
+    return completed;
+}
+
+u64 SearchCheckpoint::getTotal(u32 list) const
+{
+    return totals[list];
+}
+
+bool SearchCheckpoint::isComplete(u64 tile) const
+{
+    return offsets[tile] != 0;
+}
+
+void SearchCheckpoint::remove()
+{
+    file.close();
+
+    std::error_code error;
+    std::filesystem::remove(path, error);
+}
+
+bool SearchCheckpoint::open(const std::string &parameters)
+{
+    std::ifstream stream(path, std::ios_base::in | std::ios_base::binary);
+    if (!stream.is_open())
+    {
+        return false;
+    }
+
+    u32 magic;
+    u32 length;
+    stream.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+    stream.read(reinterpret_cast<char *>(&length), sizeof(length));
+    if (!stream || magic != MAGIC || length != parameters.size())
+    {
+        return false;
+    }
+
+    std::string header(length, '\0');
+    u64 tiles;
+    u32 lists;
+    u32 size;
+    stream.read(header.data(), header.size());
+    stream.read(reinterpret_cast<char *>(&tiles), sizeof(tiles));
+    stream.read(reinterpret_cast<char *>(&lists), sizeof(lists));
+    stream.read(reinterpret_cast<char *>(&size), sizeof(size));
+    if (!stream || header != parameters || tiles != offsets.size() || lists != this->lists || size != this->size)
+    {
+        return false;
+    }
+
+    std::error_code error;
+    u64 end = std::filesystem::file_size(path, error);
+    if (error)
+    {
+        return false;
+    }
+
+    u64 offset = stream.tellg();
+    std::vector<u32> counts(lists);
+    std::vector<u8> data;
+    while (true)
+    {
+        u64 tile;
+        stream.read(reinterpret_cast<char *>(&tile), sizeof(tile));
+        stream.read(reinterpret_cast<char *>(counts.data()), counts.size() * sizeof(u32));
+        if (!stream || tile >= tiles)
+        {
+            break;
+        }
+
+        u64 length = 0;
+        for (u32 count : counts)
+        {
+            length += static_cast<u64>(count) * size;
+        }
+
+        u64 next = offset + sizeof(tile) + counts.size() * sizeof(u32) + length + sizeof(u32);
+        if (next > end)
+        {
+            break;
+        }
+
+        u32 crc;
+        data.resize(length);
+        stream.read(reinterpret_cast<char *>(data.data()), data.size());
+        stream.read(reinterpret_cast<char *>(&crc), sizeof(crc));
+        if (!stream || crc != recordCRC(tile, counts, data))
+        {
+            break;
+        }
+
+        if (offsets[tile] == 0)
+        {
+            offsets[tile] = offset;
+            completed++;
+            for (u32 i = 0; i < lists; i++)
+            {
+                totals[i] += counts[i];
+            }
+        }
+
+        offset = next;
+    }
+    stream.close();
+
+    // Drop a record that was only partially written before the search stopped, along with anything after it
+    std::filesystem::resize_file(path, offset, error);
+    this->end = offset;
+    return !error;
+}
+
+bool SearchCheckpoint::readTile(u64 tile, std::vector<u32> &counts, std::vector<u8> &data)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    counts.assign(lists, 0);
+    data.clear();
+    if (offsets[tile] == 0)
+    {
+        return false;
+    }
+
+    // A failed read must not leave the stream unusable for the following tiles
+    file.clear();
+    file.seekg(offsets[tile] + sizeof(tile));
+    file.read(reinterpret_cast<char *>(counts.data()), counts.size() * sizeof(u32));
+    if (!file)
+    {
+        file.clear();
+        error = true;
+        return false;
+    }
+
+    u64 length = 0;
+    for (u32 count : counts)
+    {
+        length += static_cast<u64>(count) * size;
+    }
+
+    u32 crc;
+    data.resize(length);
+    file.read(reinterpret_cast<char *>(data.data()), data.size());
+    file.read(reinterpret_cast<char *>(&crc), sizeof(crc));
+    if (!file || crc != recordCRC(tile, counts, data))
+    {
+        file.clear();
+        error = true;
+        return false;
+    }
+
+    return true;
+}
+
+bool SearchCheckpoint::writeTile(u64 tile, const std::vector<u32> &counts, const std::vector<u8> &data)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (error)
+    {
+        return false;
+    }
+
+    // Records are written after the last good record, so a failed write never leaves a gap before later records
+    u32 crc = recordCRC(tile, counts, data);
+    file.clear();
+    file.seekp(end);
+    file.write(reinterpret_cast<const char *>(&tile), sizeof(tile));
+    file.write(reinterpret_cast<const char *>(counts.data()), counts.size() * sizeof(u32));
+    file.write(reinterpret_cast<const char *>(data.data()), data.size());
+    file.write(reinterpret_cast<const char *>(&crc), sizeof(crc));
+    file.flush();
+    if (!file.good())
+    {
+        file.clear();
+        error = true;
+        return false;
+    }
+
+    offsets[tile] = end;
+    end += sizeof(tile) + counts.size() * sizeof(u32) + data.size() + sizeof(crc);
+    completed++;
+    for (u32 i = 0; i < lists; i++)
+    {
+        totals[i] += counts[i];
+    }
+    return true;
+}
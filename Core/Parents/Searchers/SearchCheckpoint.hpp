@@ -0,0 +1,190 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHCHECKPOINT_HPP
+#define SEARCHCHECKPOINT_HPP
+
+#include <Core/Global.hpp>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Stores the results of completed search tiles in a file so a cancelled or crashed search can continue where it stopped.
+ * Each completed tile is appended as a record containing its result lists and a CRC32 of the record. Records that were only partially
+ * written or fail the CRC32 are discarded when the checkpoint is reopened.
+ */
+class SearchCheckpoint
+{
+public:
+    /**
+     * @brief Construct a new SearchCheckpoint object. An existing checkpoint with the same \p parameters is resumed, otherwise a new
+     * checkpoint is started.
+     *
+     * @param path Path of the checkpoint file
+     * @param parameters Search parameters the checkpoint belongs to
+     * @param tiles Number of tiles of the search
+     * @param lists Number of result lists of each tile
+     * @param size Size of a single result
+     */
+    SearchCheckpoint(std::string_view path, const std::string &parameters, u64 tiles, u32 lists, u32 size);
+
+    /**
+     * @brief Returns if writing or reading the checkpoint file failed
+     *
+     * @return true Checkpoint file failed
+     * @return false Checkpoint file is fine
+     */
+    bool failed() const;
+
+    /**
+     * @brief Returns the number of completed tiles
+     *
+     * @return Completed tiles
+     */
+    u64 getCompleted() const;
+
+    /**
+     * @brief Returns the number of results of \p list over all completed tiles
+     *
+     * @param list List index
+     *
+     * @return Number of results
+     */
+    u64 getTotal(u32 list) const;
+
+    /**
+     * @brief Checks if the \p tile has already been completed
+     *
+     * @param tile Tile index
+     *
+     * @return true Tile is complete
+     * @return false Tile still has to be searched
+     */
+    bool isComplete(u64 tile) const;
+
+    /**
+     * @brief Reads the result lists of a completed \p tile
+     *
+     * @tparam Type Result type
+     * @param tile Tile index
+     * @param results Result lists
+     *
+     * @return true Tile was read
+     * @return false Tile was never completed or reading it failed
+     */
+    template <typename Type>
+    bool read(u64 tile, std::vector<std::vector<Type>> &results)
+    {
+        std::vector<u32> counts;
+        std::vector<u8> data;
+        if (!readTile(tile, counts, data))
+        {
+            return false;
+        }
+
+        results.resize(counts.size());
+        const u8 *ptr = data.data();
+        for (u32 i = 0; i < counts.size(); i++)
+        {
+            results[i].resize(counts[i]);
+            std::memcpy(results[i].data(), ptr, counts[i] * sizeof(Type));
+            ptr += counts[i] * sizeof(Type);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Removes the checkpoint file once the search results have been saved
+     */
+    void remove();
+
+    /**
+     * @brief Stores the result lists of a completed \p tile
+     *
+     * @tparam Type Result type
+     * @param tile Tile index
+     * @param results Result lists
+     *
+     * @return true Tile was stored
+     * @return false Writing the tile failed, the tile is not marked as complete
+     */
+    template <typename Type>
+    bool write(u64 tile, const std::vector<const std::vector<Type> *> &results)
+    {
+        std::vector<u32> counts;
+        std::vector<u8> data;
+        for (const auto *list : results)
+        {
+            counts.emplace_back(list->size());
+            data.insert(data.end(), reinterpret_cast<const u8 *>(list->data()), reinterpret_cast<const u8 *>(list->data() + list->size()));
+        }
+        return writeTile(tile, counts, data);
+    }
+
+private:
+    std::fstream file;
+    std::mutex mutex;
+    std::string path;
+    std::vector<u64> offsets;
+    std::vector<u64> totals;
+    u64 completed;
+    u64 end;
+    u32 lists;
+    u32 size;
+    bool error;
+
+    /**
+     * @brief Opens an existing checkpoint and indexes its records
+     *
+     * @param parameters Search parameters the checkpoint belongs to
+     *
+     * @return true Checkpoint was opened
+     * @return false Checkpoint does not exist or belongs to a different search
+     */
+    bool open(const std::string &parameters);
+
+    /**
+     * @brief Reads the record of \p tile
+     *
+     * @param tile Tile index
+     * @param counts Number of results of each list
+     * @param data Result data of all lists
+     *
+     * @return true Record was read
+     * @return false Tile was never completed or reading the record failed
+     */
+    bool readTile(u64 tile, std::vector<u32> &counts, std::vector<u8> &data);
+
+    /**
+     * @brief Appends the record of \p tile
+     *
+     * @param tile Tile index
+     * @param counts Number of results of each list
+     * @param data Result data of all lists
+     *
+     * @return true Record was written
+     * @return false Writing the record failed
+     */
+    bool writeTile(u64 tile, const std::vector<u32> &counts, const std::vector<u8> &data);
+};
+
+#endif // SEARCHCHECKPOINT_HPP
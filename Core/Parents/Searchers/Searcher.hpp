@@ -20,7 +20,12 @@
 #ifndef SEARCHER_HPP
 #define SEARCHER_HPP
 
+#include <Core/Parents/Searchers/IVPartitioner.hpp>
 #include <Core/Parents/Searchers/SearcherBase.hpp>
+#include <Core/Parents/Searchers/TileScheduler.hpp>
+#include <Core/RNG/LCRNGReverse.hpp>
+#include <algorithm>
+#include <thread>
 
 enum class Method : u8;
 
@@ -49,6 +54,135 @@ protected:
     Profile profile;
     u16 tsv;
     Method method;
+
+    /**
+     * @brief Searches every IV combination between \p min and \p max like searchIVs, handing \p search the PokeRNG origin seeds of each
+     * combination for \p method. The origin seeds of the remaining Spe IVs of a row are recovered together by the batched
+     * LCRNGReverse::recoverPokeRNGIV and kept until the thread moves to another row.
+     *
+     * @tparam Function Function type
+     * @param threads Number of threads to search with
+     * @param min Minimum IVs
+     * @param max Maximum IVs
+     * @param method Method of the IVs
+     * @param search Function that returns the states of a single IV combination from its origin seeds
+     */
+    template <class Function>
+    void searchIVs(int threads, const std::array<u8, 6> &min, const std::array<u8, 6> &max, Method method, Function search)
+    {
+        struct Row
+        {
+            std::array<u32, 32 * 6 + 6> seeds;
+            std::array<u16, 33> offsets;
+            u32 ivs = 0;
+            u8 minSpe = 0xff;
+        };
+
+        searchIVs(threads, min, max, [method, maxSpe = max[5], search, row = Row()](const std::array<u8, 6> &ivs) mutable {
+            u32 key = ivs[0] | (ivs[1] << 5) | (ivs[2] << 10) | (ivs[3] << 15) | (ivs[4] << 20);
+            if (ivs[5] < row.minSpe || key != row.ivs)
+            {
+                std::array<u8, 32> counts;
+                LCRNGReverse::recoverPokeRNGIV(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], ivs[5], maxSpe, method, row.seeds.data(),
+                                               counts.data());
+
+                row.ivs = key;
+                row.minSpe = ivs[5];
+                row.offsets[0] = 0;
+                for (int i = 0; i <= maxSpe - row.minSpe; i++)
+                {
+                    row.offsets[i + 1] = row.offsets[i] + counts[i];
+                }
+            }
+
+            // Copying all 6 slots keeps the copy a fixed size, the padding at the end of the row covers the last Spe IV
+            u8 index = ivs[5] - row.minSpe;
+            RecoverySeeds<6> seeds;
+            seeds.count = row.offsets[index + 1] - row.offsets[index];
+            std::copy_n(row.seeds.begin() + row.offsets[index], 6, seeds.seeds);
+            return search(ivs, seeds);
+        });
+    }
+
+    /**
+     * @brief Searches every IV combination between \p min and \p max. The IV box is split into work units that are shared between the
+     * threads. Results are published in the order of the nested HP to Spe loops regardless of the number of threads.
+     *
+     * @tparam Function Function type
+     * @param threads Number of threads to search with
+     * @param min Minimum IVs
+     * @param max Maximum IVs
+     * @param search Function that returns the states of a single IV combination
+     */
+    template <class Function>
+    void searchIVs(int threads, const std::array<u8, 6> &min, const std::array<u8, 6> &max, Function search)
+    {
+        IVPartitioner partitioner(min, max, threads);
+        u64 units = partitioner.getUnits();
+        if (units == 0)
+        {
+            return;
+        }
+
+        if (units < threads)
+        {
+            threads = units;
+        }
+
+        // Finished units wait here until every unit before them is done
+        std::vector<std::vector<Result>> pending(units);
+        std::vector<bool> done(units, false);
+        u64 published = 0;
+
+        auto publish = [this, &pending, &done, &published, units] {
+            for (; published < units && done[published]; published++)
+            {
+                auto &states = pending[published];
+                this->results.insert(this->results.end(), std::make_move_iterator(states.begin()), std::make_move_iterator(states.end()));
+                std::vector<Result>().swap(states);
+            }
+        };
+
+        TileScheduler scheduler(units, threads);
+        auto *threadContainer = new std::thread[threads];
+
+        for (int i = 0; i < threads; i++)
+        {
+            // Every thread gets its own copy of the search function so it can keep state between IV combinations
+            threadContainer[i] = std::thread([this, &scheduler, &partitioner, &pending, &done, &publish, search, i]() mutable {
+                u64 unit;
+                while (this->searching && scheduler.next(i, unit))
+                {
+                    std::vector<Result> buffer;
+
+                    auto ivs = partitioner.getIVs(unit);
+                    for (u64 j = partitioner.getSize(unit); j > 0 && this->searching; j--, partitioner.next(ivs))
+                    {
+                        auto states = search(ivs);
+                        buffer.insert(buffer.end(), states.begin(), states.end());
+                        this->progress++;
+                    }
+
+                    std::lock_guard<std::mutex> guard(this->mutex);
+                    pending[unit] = std::move(buffer);
+                    done[unit] = true;
+                    publish();
+                }
+            });
+        }
+
+        for (int i = 0; i < threads; i++)
+        {
+            threadContainer[i].join();
+        }
+
+        delete[] threadContainer;
+
+        // A cancelled search leaves gaps, publish what was found in order
+        std::lock_guard<std::mutex> guard(this->mutex);
+        std::fill(done.begin(), done.end(), true);
+        publish();
+    }
 };
 
 #endif // SEARCHER_HPP
@@ -22,6 +22,7 @@
 
 #include <Core/Global.hpp>
 #include <atomic>
+#include <iterator>
 #include <mutex>
 #include <vector>
 
@@ -41,14 +42,23 @@ public:
      * @param profile Profile Information
      * @param filter State filter
      */
-    SearcherBase() : progress(0), searching(false)
+    SearcherBase() : chunks(nullptr), progress(0), searching(false)
     {
     }
 
     /**
      * @brief Destroy the SearcherBase object
      */
-    virtual ~SearcherBase() = default;
+    virtual ~SearcherBase()
+    {
+        ResultChunk *chunk = chunks.exchange(nullptr);
+        while (chunk)
+        {
+            ResultChunk *next = chunk->next;
+            delete chunk;
+            chunk = next;
+        }
+    }
 
     /**
      * @brief Cancels the running search
@@ -80,14 +90,47 @@ public:
     }
 
     /**
-     * @brief Returns the states of the running search
+     * @brief Returns the states of the running search. Chunks published by \ref pushResults() are spliced in without blocking the
+     * threads that are still searching.
      *
      * @return Vector of computed states
      */
     std::vector<Result> getResults()
     {
-        std::lock_guard<std::mutex> guard(mutex);
-        auto data = std::move(results);
+        std::vector<Result> data;
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            data = std::move(results);
+        }
+
+        // Chunks are pushed to the front of the list, reverse them to return results in publish order
+        ResultChunk *chunk = chunks.exchange(nullptr, std::memory_order_acquire);
+        ResultChunk *ordered = nullptr;
+        while (chunk)
+        {
+            ResultChunk *next = chunk->next;
+            chunk->next = ordered;
+            ordered = chunk;
+            chunk = next;
+        }
+
+        while (ordered)
+        {
+            if (data.empty())
+            {
+                data = std::move(ordered->results);
+            }
+            else
+            {
+                data.insert(data.end(), std::make_move_iterator(ordered->results.begin()),
+                            std::make_move_iterator(ordered->results.end()));
+            }
+
+            ResultChunk *next = ordered->next;
+            delete ordered;
+            ordered = next;
+        }
+
         return data;
     }
 
@@ -102,6 +145,36 @@ public:
     }
 
 protected:
+    /**
+     * @brief Publishes the results of a search thread without taking \ref mutex. Used by searchers that collect results in a per
+     * thread buffer.
+     *
+     * @param data Results to publish. Left empty after the call.
+     */
+    void pushResults(std::vector<Result> &data)
+    {
+        if (data.empty())
+        {
+            return;
+        }
+
+        auto *chunk = new ResultChunk { std::move(data), chunks.load(std::memory_order_relaxed) };
+        while (!chunks.compare_exchange_weak(chunk->next, chunk, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+        data.clear();
+    }
+
+    /**
+     * @brief Batch of results published by a single search thread
+     */
+    struct ResultChunk
+    {
+        std::vector<Result> results;
+        ResultChunk *next;
+    };
+
+    std::atomic<ResultChunk *> chunks;
     std::mutex mutex;
     std::vector<Result> results;
     std::atomic<u64> progress;
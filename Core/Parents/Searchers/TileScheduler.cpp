@@ -0,0 +1,76 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "TileScheduler.hpp"
+
+TileScheduler::TileScheduler(u64 tiles, int threads) : ranges(new Range[threads]), threads(threads)
+{
+    u64 split = tiles / threads;
+    u64 extra = tiles % threads;
+
+    u64 begin = 0;
+    for (int i = 0; i < threads; i++)
+    {
+        u64 size = split + (i < extra ? 1 : 0);
+        ranges[i].begin = begin;
+        ranges[i].end = begin + size;
+        begin += size;
+    }
+}
+
+bool TileScheduler::next(int thread, u64 &tile)
+{
+    Range &own = ranges[thread];
+    {
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (own.begin < own.end)
+        {
+            tile = own.begin++;
+            return true;
+        }
+    }
+
+    for (int i = 1; i < threads; i++)
+    {
+        Range &victim = ranges[(thread + i) % threads];
+
+        u64 begin;
+        u64 end;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.begin >= victim.end)
+            {
+                continue;
+            }
+
+            // Take the back half so the victim keeps working through its front half undisturbed
+            end = victim.end;
+            begin = victim.begin + (victim.end - victim.begin) / 2;
+            victim.end = begin;
+        }
+
+        std::lock_guard<std::mutex> lock(own.mutex);
+        tile = begin;
+        own.begin = begin + 1;
+        own.end = end;
+        return true;
+    }
+
+    return false;
+}
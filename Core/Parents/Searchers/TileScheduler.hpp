@@ -0,0 +1,68 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TILESCHEDULER_HPP
+#define TILESCHEDULER_HPP
+
+#include <Core/Global.hpp>
+#include <memory>
+#include <mutex>
+
+/**
+ * @brief Hands out work tiles to a fixed set of threads. Each thread starts with an even contiguous share of the tiles and steals
+ * half of the remaining tiles from another thread once its own share runs out.
+ */
+class TileScheduler
+{
+public:
+    /**
+     * @brief Construct a new TileScheduler object
+     *
+     * @param tiles Number of tiles
+     * @param threads Number of threads that will request tiles
+     */
+    TileScheduler(u64 tiles, int threads);
+
+    /**
+     * @brief Gets the next tile for \p thread
+     *
+     * @param thread Thread index
+     * @param tile Tile index that was assigned
+     *
+     * @return true Tile was assigned
+     * @return false No tiles remain
+     */
+    bool next(int thread, u64 &tile);
+
+private:
+    /**
+     * @brief Contiguous range of tiles owned by a thread. Padded to avoid false sharing between threads.
+     */
+    struct alignas(64) Range
+    {
+        std::mutex mutex;
+        u64 begin;
+        u64 end;
+    };
+
+    std::unique_ptr<Range[]> ranges;
+    int threads;
+};
+
+#endif // TILESCHEDULER_HPP
@@ -21,6 +21,7 @@
 #define LCRNG64_HPP
 
 #include <Core/Global.hpp>
+#include <Core/RNG/SIMD.hpp>
 
 struct Jump64
 {
@@ -267,7 +268,107 @@ private:
     u64 seed;
 };
 
+#ifdef SIMD_X86
+/**
+ * @brief Provides random numbers via the LCRNG algorithm for 4 seeds at once. Each 64bit lane of the vector belongs to a different seed.
+ * AVX2 has no 64bit multiply, so it is built from 32bit multiplies. Must only be used when \ref hasAVX2() is true.
+ *
+ * @tparam add LCRNG64 addition value
+ * @tparam mult LCRNG64 multiplication value
+ */
+template <u64 add, u64 mult>
+class LCRNG64Multi
+{
+public:
+    /**
+     * @brief Construct a new LCRNG64Multi object
+     *
+     * @param seeds Starting PRNG state of each lane
+     */
+    LCRNG64Multi(const u64 *seeds)
+    {
+        seed.uint256 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(seeds));
+    }
+
+    /**
+     * @brief Advances the RNG of every lane by \p advances amount
+     *
+     * @param advances Number of advances
+     */
+    void advance(u32 advances)
+    {
+        for (u32 advance = 0; advance < advances; advance++)
+        {
+            seed.uint256 = compute(seed.uint256);
+        }
+    }
+
+    /**
+     * @brief Returns the current PRNG state of each lane
+     *
+     * @return PRNG states
+     */
+    vuint256 getSeed() const
+    {
+        return seed;
+    }
+
+    /**
+     * @brief Gets the next 64bit PRNG state of the lanes in \p mask. The other lanes keep their state.
+     *
+     * @param mask Lanes to advance, with each 64bit lane being all ones or zero
+     *
+     * @return PRNG value of each lane
+     */
+    vuint256 next(vuint256 mask)
+    {
+        seed.uint256 = _mm256_blendv_epi8(seed.uint256, compute(seed.uint256), mask.uint256);
+        return seed;
+    }
+
+    /**
+     * @brief Gets the next 32bit PRNG state bounded by the \p max value of the lanes in \p mask. The other lanes keep their state.
+     *
+     * @param max Max bounding value
+     * @param mask Lanes to advance, with each 64bit lane being all ones or zero
+     *
+     * @return PRNG value of each lane in the low 32bits of its 64bit lane
+     */
+    vuint256 nextUInt(u32 max, vuint256 mask)
+    {
+        vuint256 ret;
+        ret.uint256 = _mm256_srli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(next(mask).uint256, 32), _mm256_set1_epi64x(max)), 32);
+        return ret;
+    }
+
+private:
+    vuint256 seed;
+
+    /**
+     * @brief Computes the next PRNG state of each lane
+     *
+     * @param x Current PRNG states
+     *
+     * @return Next PRNG states
+     */
+    static __m256i compute(__m256i x)
+    {
+        __m256i low = _mm256_set1_epi64x(mult & 0xffffffff);
+        __m256i high = _mm256_set1_epi64x(mult >> 32);
+
+        // (x.hi * 2^32 + x.lo) * (m.hi * 2^32 + m.lo) mod 2^64 = x.lo * m.lo + ((x.lo * m.hi + x.hi * m.lo) << 32)
+        __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(x, high), _mm256_mul_epu32(_mm256_srli_epi64(x, 32), low));
+        __m256i product = _mm256_add_epi64(_mm256_mul_epu32(x, low), _mm256_slli_epi64(cross, 32));
+        return _mm256_add_epi64(product, _mm256_set1_epi64x(add));
+    }
+};
+#endif
+
 using BWRNG = LCRNG64<0x269ec3, 0x5d588b656c078965>;
 using BWRNGR = LCRNG64<0x9b1ae6e9a384e6f9, 0xdedcedae9638806d>;
 
+#ifdef SIMD_X86
+using BWRNGMulti = LCRNG64Multi<0x269ec3, 0x5d588b656c078965>;
+#endif
+
 #endif // LCRNG64_HPP
@@ -20,6 +20,48 @@
 #include "LCRNGReverse.hpp"
 #include <Core/Enum/Method.hpp>
 #include <Core/RNG/LCRNG.hpp>
+#include <Core/RNG/SIMD.hpp>
+#include <bit>
+
+/**
+ * @brief Computes the upper 32bits of the 64bit product of each 32bit number pair in the vector from 16bit halves
+ *
+ * @tparam Vector SIMD vector type
+ * @param x First operand
+ * @param m Second operand
+ *
+ * @return Upper 32bits of the products
+ */
+template <class Vector>
+static Vector mulhi(Vector x, u32 m)
+{
+    Vector mask(0xffff);
+    Vector xl = x & mask;
+    Vector xh = x >> 16;
+    Vector ml(m & 0xffff);
+    Vector mh(m >> 16);
+
+    Vector t = xh * ml + ((xl * ml) >> 16);
+    Vector u = xl * mh + (t & mask);
+    return xh * mh + (t >> 16) + (u >> 16);
+}
+
+/**
+ * @brief Computes the remainder of each 32bit number in the vector by \p divisor with multiply and shift
+ *
+ * @tparam divisor Divisor
+ * @tparam magic Rounded up reciprocal of \p divisor scaled by 2^(32 + shift)
+ * @tparam shift Extra shift of \p magic
+ * @tparam Vector SIMD vector type
+ * @param x Dividends
+ *
+ * @return Remainders
+ */
+template <u32 divisor, u32 magic, int shift, class Vector>
+static Vector mod(Vector x)
+{
+    return x + (mulhi(x, magic) >> shift) * Vector(0 - divisor);
+}
 
 /**
  * @brief Recovers origin seeds for two 16 bit calls(15 bits known) without gap
@@ -150,6 +192,173 @@ static RecoverySeeds<6> recoverPokeRNGIVMethod4(u8 hp, u8 atk, u8 def, u8 spa, u
     return seeds;
 }
 
+/**
+ * @brief Recovers origin seeds for two 16 bit calls(15 bits known) without gap for every Spe IV between \p minSpe and \p maxSpe.
+ * Each lane of \p Vector handles one Spe IV through the lattice arithmetic and the verification of its 6 candidate slots.
+ *
+ * @tparam Vector SIMD vector type
+ * @param hp HP iv
+ * @param atk Atk iv
+ * @param def Def iv
+ * @param spa SpA iv
+ * @param spd SpD iv
+ * @param minSpe Minimum Spe iv
+ * @param maxSpe Maximum Spe iv
+ * @param seeds Array to write results, grouped by Spe iv
+ * @param counts Array to write the number of origin seeds of each Spe iv
+ *
+ * @return Total number of origin seeds
+ */
+template <class Vector>
+static int recoverPokeRNGIVMethod12(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 minSpe, u8 maxSpe, u32 *seeds, u8 *counts)
+{
+    constexpr u32 LAG0 = 0x6134;
+    constexpr u32 LAG1 = 0xC907;
+    constexpr u32 LOWER = 0x64833CB0;
+    constexpr u32 UPPER = 0x6483CBBC;
+    constexpr u32 lanes = sizeof(Vector) / sizeof(u32);
+
+    u32 first = static_cast<u32>((hp | (atk << 5) | (def << 10)) << 16);
+
+    Vector zero(0);
+    Vector lowMask(0x7fff);
+    Vector highMask(0x7fff0000);
+    Vector mult(PokeRNG::getMult());
+    Vector add(PokeRNG::getAdd());
+
+    int total = 0;
+    for (u32 spe = minSpe; spe <= maxSpe; spe += lanes)
+    {
+        Vector second;
+        for (u32 lane = 0; lane < lanes; lane++)
+        {
+            second.uint32[lane] = static_cast<u32>((((spe + lane) & 31) | (spa << 5) | (spd << 10)) << 16);
+        }
+
+        // Same as the scalar version, the 33bit sums are split into their lower 15 bits to keep the carry
+        Vector tmp = ((Vector(PokeRNG::getMult() * first + 1) + ~second) >> 16) * Vector(LAG1);
+        Vector lo = ((tmp >> 15) + Vector(LOWER >> 15) + (((tmp & lowMask) + Vector(LOWER & 0x7fff)) >> 15)) * Vector(LAG0);
+        Vector mi = lo + Vector(LAG0);
+        Vector up = ((tmp >> 15) + Vector(UPPER >> 15) + (((tmp & lowMask) + Vector(UPPER & 0x7fff)) >> 15)) * Vector(LAG0);
+
+        Vector starts[3] = { mod<LAG1, 0xa300b103, 15>(lo), mod<LAG1, 0xa300b103, 15>(mi), mod<LAG1, 0xa300b103, 15>(up) };
+        Vector valid[3] = { ~zero, ~zero, ~(mi == up) };
+
+        Vector candidates[6];
+        Vector matches[6];
+        for (int i = 0; i < 3; i++)
+        {
+            Vector lbits = starts[i] + Vector(LAG1);
+
+            candidates[2 * i] = Vector(first) | starts[i];
+            candidates[2 * i + 1] = Vector(first) | (lbits & Vector(0xffff));
+
+            matches[2 * i] = (((candidates[2 * i] * mult + add) & highMask) == second) & valid[i];
+            matches[2 * i + 1] = (((candidates[2 * i + 1] * mult + add) & highMask) == second) & valid[i] & ((lbits >> 16) == zero);
+        }
+
+        // Gather the matching slots of each lane into a bitmask and emit them in slot order
+        Vector bits = (matches[0] & Vector(1)) | (matches[1] & Vector(2)) | (matches[2] & Vector(4)) | (matches[3] & Vector(8))
+            | (matches[4] & Vector(16)) | (matches[5] & Vector(32));
+        for (u32 lane = 0; lane < lanes && spe + lane <= maxSpe; lane++)
+        {
+            u32 start = total;
+            for (u32 mask = bits.uint32[lane]; mask != 0; mask &= mask - 1)
+            {
+                u32 seed = candidates[std::countr_zero(mask)].uint32[lane];
+                seeds[total++] = seed;
+                seeds[total++] = seed ^ 0x80000000;
+            }
+            counts[spe + lane - minSpe] = total - start;
+        }
+    }
+
+    return total;
+}
+
+/**
+ * @brief Recovers origin seeds for two 16 bit calls(15 bits known) with gap for every Spe IV between \p minSpe and \p maxSpe.
+ * Each lane of \p Vector handles one Spe IV through the lattice arithmetic and the verification of its 6 candidate slots.
+ *
+ * @tparam Vector SIMD vector type
+ * @param hp HP iv
+ * @param atk Atk iv
+ * @param def Def iv
+ * @param spa SpA iv
+ * @param spd SpD iv
+ * @param minSpe Minimum Spe iv
+ * @param maxSpe Maximum Spe iv
+ * @param seeds Array to write results, grouped by Spe iv
+ * @param counts Array to write the number of origin seeds of each Spe iv
+ *
+ * @return Total number of origin seeds
+ */
+template <class Vector>
+static int recoverPokeRNGIVMethod4(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 minSpe, u8 maxSpe, u32 *seeds, u8 *counts)
+{
+    constexpr u32 LAG0 = 0x6C31;
+    constexpr u32 LAG1 = 0x2E90;
+    constexpr u32 LOWER = 0x4B8CE21D;
+    constexpr u32 UPPER = 0x4B8D08D7;
+    constexpr u32 MULT = PokeRNGR::getMult() * PokeRNGR::getMult();
+    constexpr u32 ADD = PokeRNGR::getAdd() * (PokeRNGR::getMult() + 1);
+    constexpr u32 lanes = sizeof(Vector) / sizeof(u32);
+
+    u32 first = static_cast<u32>((hp | (atk << 5) | (def << 10)) << 16);
+
+    Vector zero(0);
+    Vector highMask(0x7fff0000);
+    Vector mult(MULT);
+    Vector add(ADD);
+
+    int total = 0;
+    for (u32 spe = minSpe; spe <= maxSpe; spe += lanes)
+    {
+        Vector second;
+        for (u32 lane = 0; lane < lanes; lane++)
+        {
+            second.uint32[lane] = static_cast<u32>((((spe + lane) & 31) | (spa << 5) | (spd << 10)) << 16);
+        }
+
+        Vector tmp = ((Vector(first) + second * Vector(0 - MULT)) >> 16) * Vector(LAG0);
+        Vector lo = (tmp + Vector(LOWER)) >> 15;
+        Vector up = (tmp + Vector(UPPER)) >> 15;
+
+        Vector starts[2] = { mod<LAG0, 0x976f70ff, 14>(lo * Vector(LAG1)), mod<LAG0, 0x976f70ff, 14>(up * Vector(LAG1)) };
+        Vector valid[2] = { ~zero, ~(lo == up) };
+
+        Vector states[6];
+        Vector matches[6];
+        for (int i = 0; i < 2; i++)
+        {
+            for (int j = 0; j < 3; j++)
+            {
+                Vector lbits = starts[i] + Vector(j * LAG0);
+
+                states[3 * i + j] = (second | lbits) * mult + add;
+                matches[3 * i + j] = ((states[3 * i + j] & highMask) == Vector(first)) & valid[i] & ((lbits >> 16) == zero);
+            }
+        }
+
+        // Gather the matching slots of each lane into a bitmask and emit them in slot order
+        Vector bits = (matches[0] & Vector(1)) | (matches[1] & Vector(2)) | (matches[2] & Vector(4)) | (matches[3] & Vector(8))
+            | (matches[4] & Vector(16)) | (matches[5] & Vector(32));
+        for (u32 lane = 0; lane < lanes && spe + lane <= maxSpe; lane++)
+        {
+            u32 start = total;
+            for (u32 mask = bits.uint32[lane]; mask != 0; mask &= mask - 1)
+            {
+                u32 seed = states[std::countr_zero(mask)].uint32[lane];
+                seeds[total++] = seed;
+                seeds[total++] = seed ^ 0x80000000;
+            }
+            counts[spe + lane - minSpe] = total - start;
+        }
+    }
+
+    return total;
+}
+
 namespace LCRNGReverse
 {
     RecoverySeeds<12> recoverChannelIV(u32 hp, u32 atk, u32 def, u32 spa, u32 spd, u32 spe)
@@ -253,6 +462,25 @@ namespace LCRNGReverse
         return recoverPokeRNGIVMethod12(hp, atk, def, spa, spd, spe);
     }
 
+    int recoverPokeRNGIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 minSpe, u8 maxSpe, Method method, u32 *seeds, u8 *counts)
+    {
+#ifdef SIMD_X86
+        if (hasAVX2())
+        {
+            if (method == Method::Method4)
+            {
+                return recoverPokeRNGIVMethod4<vuint256>(hp, atk, def, spa, spd, minSpe, maxSpe, seeds, counts);
+            }
+            return recoverPokeRNGIVMethod12<vuint256>(hp, atk, def, spa, spd, minSpe, maxSpe, seeds, counts);
+        }
+#endif
+        if (method == Method::Method4)
+        {
+            return recoverPokeRNGIVMethod4<vuint128>(hp, atk, def, spa, spd, minSpe, maxSpe, seeds, counts);
+        }
+        return recoverPokeRNGIVMethod12<vuint128>(hp, atk, def, spa, spd, minSpe, maxSpe, seeds, counts);
+    }
+
     RecoverySeeds<3> recoverPokeRNGPID(u32 pid)
     {
         constexpr u32 LAG0 = 0x7ED7;
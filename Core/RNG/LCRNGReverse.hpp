@@ -38,12 +38,18 @@ struct RecoverySeeds
     {
         return seeds[i];
     }
+
+    u32 operator[](int i) const
+    {
+        return seeds[i];
+    }
 };
 
 /**
  * @brief Provides a way to compute origin seed given IVs or PID.
  * 
  * All attacks are based on a lattice reduction method. See https://github.com/StarfBerry/PokeRNG/blob/main/Recovery/LCG_Recovery.py
+ * A recovery takes a handful of multiplies, which is cheaper than a lookup into a precomputed IV to seed table would be.
  */
 namespace LCRNGReverse
 {
@@ -76,6 +82,25 @@ namespace LCRNGReverse
      */
     RecoverySeeds<6> recoverPokeRNGIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, Method method);
 
+    /**
+     * @brief Recovers origin seeds for two 16 bit calls(15 bits known) with or without gap for every Spe IV between \p minSpe and
+     * \p maxSpe. The candidates of all Spe IVs are verified together in SIMD lanes.
+     *
+     * @param hp HP iv
+     * @param atk Atk iv
+     * @param def Def iv
+     * @param spa SpA iv
+     * @param spd SpD iv
+     * @param minSpe Minimum Spe iv
+     * @param maxSpe Maximum Spe iv
+     * @param method Method of the IVs
+     * @param seeds Array to write results, grouped by Spe iv in ascending order (needs room for 6 per Spe iv)
+     * @param counts Array to write the number of origin seeds of each Spe iv
+     *
+     * @return Total number of origin seeds
+     */
+    int recoverPokeRNGIV(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 minSpe, u8 maxSpe, Method method, u32 *seeds, u8 *counts);
+
     /**
      * @brief Recovers origin seeds for two 16 bit calls
      *
@@ -158,4 +158,89 @@ private:
     u16 index;
 };
 
+/**
+ * @brief Provides random numbers via the Mersenne Twister algorithm for multiple seeds at once.
+ * Uses the same simplifications as MTFast, but each 32bit lane of the internal state belongs to a different seed.
+ * This allows the initialization of the internal MT array to also take advantage of SIMD.
+ *
+ * @tparam size Number of values to have generated
+ * @tparam fast Whether to skip last bit shift operations
+ * @tparam Vector SIMD vector type, which decides the number of seeds
+ */
+template <u16 size, bool fast = false, class Vector = vuint128>
+class MTFastMulti
+{
+public:
+    /**
+     * @brief Construct a new MTFastMulti object
+     *
+     * @param seed Starting PRNG state of each lane
+     * @param advances Number of initial advances
+     */
+    MTFastMulti(Vector seed, u32 advances = 0) : index(advances)
+    {
+        static_assert(size < 227, "Size exceeds range of MTFastMulti");
+
+        Vector mult(0x6c078965);
+
+        state[0] = seed;
+        for (u32 i = 1; i < size + 1; i++)
+        {
+            seed = mult * (seed ^ (seed >> 30)) + i;
+            state[i] = seed;
+        }
+
+        for (u32 i = size + 1; i < 397; i++)
+        {
+            seed = mult * (seed ^ (seed >> 30)) + i;
+        }
+
+        Vector upperMask(0x80000000);
+        Vector lowerMask(0x7fffffff);
+        Vector matrix(0x9908b0df);
+        Vector one(1);
+        Vector mask1(0x9d2c5680);
+        Vector mask2(fast ? 0xe8000000 : 0xefc60000);
+
+        for (u32 i = 0; i < size; i++)
+        {
+            seed = mult * (seed ^ (seed >> 30)) + (i + 397);
+
+            Vector y = (state[i] & upperMask) | (state[i + 1] & lowerMask);
+            Vector y1 = y >> 1;
+            Vector mag01 = ((y & one) == one) & matrix;
+
+            // Temper results while shuffling
+            y = y1 ^ mag01 ^ seed;
+            y = y ^ (y >> 11);
+            y = y ^ ((y << 7) & mask1);
+            y = y ^ ((y << 15) & mask2);
+            if constexpr (fast)
+            {
+                y = y >> 27;
+            }
+            else
+            {
+                y = y ^ (y >> 18);
+            }
+
+            state[i] = y;
+        }
+    }
+
+    /**
+     * @brief Gets the next 32bit PRNG state of each lane
+     *
+     * @return PRNG value of each lane
+     */
+    Vector next()
+    {
+        return state[index++];
+    }
+
+private:
+    Vector state[size + 1];
+    u16 index;
+};
+
 #endif // MTFAST_HPP
@@ -22,9 +22,11 @@
 #include <Core/Gen5/Nazos.hpp>
 #include <Core/Gen5/Profile5.hpp>
 #include <Core/RNG/LCRNG64.hpp>
+#include <Core/RNG/SHA1Schedule.hpp>
 #include <Core/Util/DateTime.hpp>
 #include <algorithm>
 #include <bit>
+#include <vector>
 
 static u32 calcW(u32 *data, int i)
 {
@@ -170,6 +172,88 @@ static inline void section4CalcSSE(vuint128 a, vuint128 &b, vuint128 c, vuint128
 constexpr std::array<u32, 36525> dateValues = computeDateValues();
 constexpr std::array<u32, 86400> timeValues = computeTimeValues();
 
+/**
+ * @brief Computes the contribution of the time parameter being \p time to words 16-79 of the message schedule
+ *
+ * @param time Time parameter
+ *
+ * @return Contribution to words 16-79
+ */
+static std::array<u32, 64> computeTimeSchedule(u32 time)
+{
+    u32 w[80] = {};
+    w[9] = time;
+    for (int i = 16; i < 80; i++)
+    {
+        calcW(w, i);
+    }
+
+    std::array<u32, 64> schedule;
+    std::copy_n(&w[16], 64, schedule.begin());
+    return schedule;
+}
+
+/**
+ * @brief Computes the second contributions of each of the 15 phases of batches of \p lanes consecutive times
+ *
+ * @tparam lanes Number of consecutive times per batch
+ *
+ * @return Second contributions
+ */
+template <u8 lanes>
+static std::array<u32, 15 * 64 * lanes> computeSecondSchedule()
+{
+    std::array<std::array<u32, 64>, 60> seconds;
+    for (u8 second = 0; second < 60; second++)
+    {
+        seconds[second] = computeTimeSchedule(timeValues[second]);
+    }
+
+    std::array<u32, 15 * 64 * lanes> schedule;
+    for (u8 phase = 0; phase < 15; phase++)
+    {
+        for (u8 i = 0; i < 64; i++)
+        {
+            for (u8 lane = 0; lane < lanes; lane++)
+            {
+                schedule[(phase * 64 + i) * lanes + lane] = seconds[(phase * lanes + lane) % 60][i];
+            }
+        }
+    }
+    return schedule;
+}
+
+namespace SHA1ScheduleTables
+{
+    const std::array<u32, 64> &getMinute(u16 minute)
+    {
+        static const auto minutes = [] {
+            std::vector<std::array<u32, 64>> minutes(1440);
+            for (u16 i = 0; i < 1440; i++)
+            {
+                minutes[i] = computeTimeSchedule(timeValues[i * 60]);
+            }
+            return minutes;
+        }();
+        return minutes[minute];
+    }
+
+    const std::array<u32, 64> &getPM()
+    {
+        static const auto pm = computeTimeSchedule(0x40000000);
+        return pm;
+    }
+
+    const u32 *getSecond(u8 lanes, u8 phase)
+    {
+        alignas(64) static const auto seconds4 = computeSecondSchedule<4>();
+        alignas(64) static const auto seconds8 = computeSecondSchedule<8>();
+
+        const u32 *seconds = lanes == 4 ? seconds4.data() : seconds8.data();
+        return seconds + phase * 64 * lanes;
+    }
+}
+
 SHA1::SHA1(const Profile5 &profile) :
     SHA1(profile.getVersion(), profile.getLanguage(), profile.getDSType(), profile.getMac(), profile.getVFrame(), profile.getGxStat())
 {
@@ -399,6 +483,8 @@ std::array<u64, 4> SHA1SSE::hashSeed(const std::array<vuint128, 5> &alpha)
     vuint128 e = alpha[4];
     vuint128 t;
 
+    schedule.compute(data);
+
     // Section 1: 0-19
     // 0-8 already computed
     section1CalcSSE(a, b, c, d, e, t, data[9]);
@@ -409,75 +495,75 @@ std::array<u64, 4> SHA1SSE::hashSeed(const std::array<vuint128, 5> &alpha)
     section1CalcSSE(b, c, d, e, t, a, data[14]);
     section1CalcSSE(a, b, c, d, e, t, data[15]);
     section1CalcSSE(t, a, b, c, d, e, data[16]);
-    section1CalcSSE(e, t, a, b, c, d, calcWSSE(data, 17));
+    section1CalcSSE(e, t, a, b, c, d, schedule.getWord(17));
     section1CalcSSE(d, e, t, a, b, c, data[18]);
     section1CalcSSE(c, d, e, t, a, b, data[19]);
 
     // Section 2: 20 - 39
-    section2CalcSSE(b, c, d, e, t, a, calcWSSE(data, 20));
+    section2CalcSSE(b, c, d, e, t, a, schedule.getWord(20));
     section2CalcSSE(a, b, c, d, e, t, data[21]);
     section2CalcSSE(t, a, b, c, d, e, data[22]);
-    section2CalcSSE(e, t, a, b, c, d, calcWSSE(data, 23));
+    section2CalcSSE(e, t, a, b, c, d, schedule.getWord(23));
     section2CalcSSE(d, e, t, a, b, c, data[24]);
-    section2CalcSSE(c, d, e, t, a, b, calcWSSE(data, 25));
-    section2CalcSSE(b, c, d, e, t, a, calcWSSE(data, 26));
+    section2CalcSSE(c, d, e, t, a, b, schedule.getWord(25));
+    section2CalcSSE(b, c, d, e, t, a, schedule.getWord(26));
     section2CalcSSE(a, b, c, d, e, t, data[27]);
-    section2CalcSSE(t, a, b, c, d, e, calcWSSE(data, 28));
-    section2CalcSSE(e, t, a, b, c, d, calcWSSE(data, 29));
+    section2CalcSSE(t, a, b, c, d, e, schedule.getWord(28));
+    section2CalcSSE(e, t, a, b, c, d, schedule.getWord(29));
     section2CalcSSE(d, e, t, a, b, c, data[30]);
-    section2CalcSSE(c, d, e, t, a, b, calcWSSE(data, 31));
-    section2CalcSSE(b, c, d, e, t, a, calcWSSE(data, 32));
-    section2CalcSSE(a, b, c, d, e, t, calcWSSE(data, 33));
-    section2CalcSSE(t, a, b, c, d, e, calcWSSE(data, 34));
-    section2CalcSSE(e, t, a, b, c, d, calcWSSE(data, 35));
-    section2CalcSSE(d, e, t, a, b, c, calcWSSE(data, 36));
-    section2CalcSSE(c, d, e, t, a, b, calcWSSE(data, 37));
-    section2CalcSSE(b, c, d, e, t, a, calcWSSE(data, 38));
-    section2CalcSSE(a, b, c, d, e, t, calcWSSE(data, 39));
+    section2CalcSSE(c, d, e, t, a, b, schedule.getWord(31));
+    section2CalcSSE(b, c, d, e, t, a, schedule.getWord(32));
+    section2CalcSSE(a, b, c, d, e, t, schedule.getWord(33));
+    section2CalcSSE(t, a, b, c, d, e, schedule.getWord(34));
+    section2CalcSSE(e, t, a, b, c, d, schedule.getWord(35));
+    section2CalcSSE(d, e, t, a, b, c, schedule.getWord(36));
+    section2CalcSSE(c, d, e, t, a, b, schedule.getWord(37));
+    section2CalcSSE(b, c, d, e, t, a, schedule.getWord(38));
+    section2CalcSSE(a, b, c, d, e, t, schedule.getWord(39));
 
     // Section 3: 40 - 59
-    section3CalcSSE(t, a, b, c, d, e, calcWSSE(data, 40));
-    section3CalcSSE(e, t, a, b, c, d, calcWSSE(data, 41));
-    section3CalcSSE(d, e, t, a, b, c, calcWSSE(data, 42));
-    section3CalcSSE(c, d, e, t, a, b, calcWSSE(data, 43));
-    section3CalcSSE(b, c, d, e, t, a, calcWSSE(data, 44));
-    section3CalcSSE(a, b, c, d, e, t, calcWSSE(data, 45));
-    section3CalcSSE(t, a, b, c, d, e, calcWSSE(data, 46));
-    section3CalcSSE(e, t, a, b, c, d, calcWSSE(data, 47));
-    section3CalcSSE(d, e, t, a, b, c, calcWSSE(data, 48));
-    section3CalcSSE(c, d, e, t, a, b, calcWSSE(data, 49));
-    section3CalcSSE(b, c, d, e, t, a, calcWSSE(data, 50));
-    section3CalcSSE(a, b, c, d, e, t, calcWSSE(data, 51));
-    section3CalcSSE(t, a, b, c, d, e, calcWSSE(data, 52));
-    section3CalcSSE(e, t, a, b, c, d, calcWSSE(data, 53));
-    section3CalcSSE(d, e, t, a, b, c, calcWSSE(data, 54));
-    section3CalcSSE(c, d, e, t, a, b, calcWSSE(data, 55));
-    section3CalcSSE(b, c, d, e, t, a, calcWSSE(data, 56));
-    section3CalcSSE(a, b, c, d, e, t, calcWSSE(data, 57));
-    section3CalcSSE(t, a, b, c, d, e, calcWSSE(data, 58));
-    section3CalcSSE(e, t, a, b, c, d, calcWSSE(data, 59));
+    section3CalcSSE(t, a, b, c, d, e, schedule.getWord(40));
+    section3CalcSSE(e, t, a, b, c, d, schedule.getWord(41));
+    section3CalcSSE(d, e, t, a, b, c, schedule.getWord(42));
+    section3CalcSSE(c, d, e, t, a, b, schedule.getWord(43));
+    section3CalcSSE(b, c, d, e, t, a, schedule.getWord(44));
+    section3CalcSSE(a, b, c, d, e, t, schedule.getWord(45));
+    section3CalcSSE(t, a, b, c, d, e, schedule.getWord(46));
+    section3CalcSSE(e, t, a, b, c, d, schedule.getWord(47));
+    section3CalcSSE(d, e, t, a, b, c, schedule.getWord(48));
+    section3CalcSSE(c, d, e, t, a, b, schedule.getWord(49));
+    section3CalcSSE(b, c, d, e, t, a, schedule.getWord(50));
+    section3CalcSSE(a, b, c, d, e, t, schedule.getWord(51));
+    section3CalcSSE(t, a, b, c, d, e, schedule.getWord(52));
+    section3CalcSSE(e, t, a, b, c, d, schedule.getWord(53));
+    section3CalcSSE(d, e, t, a, b, c, schedule.getWord(54));
+    section3CalcSSE(c, d, e, t, a, b, schedule.getWord(55));
+    section3CalcSSE(b, c, d, e, t, a, schedule.getWord(56));
+    section3CalcSSE(a, b, c, d, e, t, schedule.getWord(57));
+    section3CalcSSE(t, a, b, c, d, e, schedule.getWord(58));
+    section3CalcSSE(e, t, a, b, c, d, schedule.getWord(59));
 
     // Section 3: 60 - 79
-    section4CalcSSE(d, e, t, a, b, c, calcWSSE(data, 60));
-    section4CalcSSE(c, d, e, t, a, b, calcWSSE(data, 61));
-    section4CalcSSE(b, c, d, e, t, a, calcWSSE(data, 62));
-    section4CalcSSE(a, b, c, d, e, t, calcWSSE(data, 63));
-    section4CalcSSE(t, a, b, c, d, e, calcWSSE(data, 64));
-    section4CalcSSE(e, t, a, b, c, d, calcWSSE(data, 65));
-    section4CalcSSE(d, e, t, a, b, c, calcWSSE(data, 66));
-    section4CalcSSE(c, d, e, t, a, b, calcWSSE(data, 67));
-    section4CalcSSE(b, c, d, e, t, a, calcWSSE(data, 68));
-    section4CalcSSE(a, b, c, d, e, t, calcWSSE(data, 69));
-    section4CalcSSE(t, a, b, c, d, e, calcWSSE(data, 70));
-    section4CalcSSE(e, t, a, b, c, d, calcWSSE(data, 71));
-    section4CalcSSE(d, e, t, a, b, c, calcWSSE(data, 72));
-    section4CalcSSE(c, d, e, t, a, b, calcWSSE(data, 73));
-    section4CalcSSE(b, c, d, e, t, a, calcWSSE(data, 74));
-    section4CalcSSE(a, b, c, d, e, t, calcWSSE(data, 75));
-    section4CalcSSE(t, a, b, c, d, e, calcWSSE(data, 76));
-    section4CalcSSE(e, t, a, b, c, d, calcWSSE(data, 77));
-    section4CalcSSE(d, e, t, a, b, c, calcWSSE(data, 78));
-    section4CalcSSE(c, d, e, t, a, b, calcWSSE(data, 79));
+    section4CalcSSE(d, e, t, a, b, c, schedule.getWord(60));
+    section4CalcSSE(c, d, e, t, a, b, schedule.getWord(61));
+    section4CalcSSE(b, c, d, e, t, a, schedule.getWord(62));
+    section4CalcSSE(a, b, c, d, e, t, schedule.getWord(63));
+    section4CalcSSE(t, a, b, c, d, e, schedule.getWord(64));
+    section4CalcSSE(e, t, a, b, c, d, schedule.getWord(65));
+    section4CalcSSE(d, e, t, a, b, c, schedule.getWord(66));
+    section4CalcSSE(c, d, e, t, a, b, schedule.getWord(67));
+    section4CalcSSE(b, c, d, e, t, a, schedule.getWord(68));
+    section4CalcSSE(a, b, c, d, e, t, schedule.getWord(69));
+    section4CalcSSE(t, a, b, c, d, e, schedule.getWord(70));
+    section4CalcSSE(e, t, a, b, c, d, schedule.getWord(71));
+    section4CalcSSE(d, e, t, a, b, c, schedule.getWord(72));
+    section4CalcSSE(c, d, e, t, a, b, schedule.getWord(73));
+    section4CalcSSE(b, c, d, e, t, a, schedule.getWord(74));
+    section4CalcSSE(a, b, c, d, e, t, schedule.getWord(75));
+    section4CalcSSE(t, a, b, c, d, e, schedule.getWord(76));
+    section4CalcSSE(e, t, a, b, c, d, schedule.getWord(77));
+    section4CalcSSE(d, e, t, a, b, c, schedule.getWord(78));
+    section4CalcSSE(c, d, e, t, a, b, schedule.getWord(79));
 
     vuint128 part1 = v32x4_byteswap(b + vuint128(0x67452301));
     vuint128 part2 = v32x4_byteswap(c + vuint128(0xefcdab89));
@@ -520,22 +606,36 @@ std::array<vuint128, 5> SHA1SSE::precompute()
     calcWSSE(data, 27);
     calcWSSE(data, 30);
 
+    schedule.reset();
+
     return { d, e, t, a, b };
 }
 
 void SHA1SSE::setButton(u32 button)
 {
     data[12] = vuint128(button);
+    schedule.reset();
 }
 
 void SHA1SSE::setDate(const Date &date)
 {
     data[8] = vuint128(dateValues[date.getJD() - Date().getJD()]);
+    schedule.reset();
 }
 
 void SHA1SSE::setTimer0(u32 timer0, u8 vcount)
 {
     data[5] = vuint128(std::byteswap(static_cast<u32>(vcount << 16) | timer0));
+    schedule.reset();
+}
+
+void SHA1SSE::setTimer0(u32 timer0, const std::array<u8, 4> &vcount)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        data[5].uint32[i] = std::byteswap(static_cast<u32>(vcount[i] << 16) | timer0);
+    }
+    schedule.reset();
 }
 
 void SHA1SSE::setTime(u8 hour, u8 minute, u8 second, DSType dsType)
@@ -551,6 +651,21 @@ void SHA1SSE::setTime(u32 time, DSType dsType)
         val = val ^ 0x40000000;
     }
     data[9] = val;
+    schedule.setTime(time, dsType == DSType::DS3);
+}
+
+void SHA1SSE::setTime(const std::array<u32, 4> &time, DSType dsType)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        u32 val = timeValues[time[i]];
+        if (time[i] >= 43200 && dsType == DSType::DS3)
+        {
+            val ^= 0x40000000;
+        }
+        data[9].uint32[i] = val;
+    }
+    schedule.setTime();
 }
 
 #ifdef SIMD_X86
@@ -621,6 +736,8 @@ std::array<u64, 8> SHA1AVX2::hashSeed(const std::array<vuint256, 5> &alpha)
     vuint256 e = alpha[4];
     vuint256 t;
 
+    schedule.compute(data);
+
     // Section 1: 0-19
     // 0-8 already computed
     section1CalcAVX2(a, b, c, d, e, t, data[9]);
@@ -631,75 +748,75 @@ std::array<u64, 8> SHA1AVX2::hashSeed(const std::array<vuint256, 5> &alpha)
     section1CalcAVX2(b, c, d, e, t, a, data[14]);
     section1CalcAVX2(a, b, c, d, e, t, data[15]);
     section1CalcAVX2(t, a, b, c, d, e, data[16]);
-    section1CalcAVX2(e, t, a, b, c, d, calcWAVX2(data, 17));
+    section1CalcAVX2(e, t, a, b, c, d, schedule.getWord(17));
     section1CalcAVX2(d, e, t, a, b, c, data[18]);
     section1CalcAVX2(c, d, e, t, a, b, data[19]);
 
     // Section 2: 20 - 39
-    section2CalcAVX2(b, c, d, e, t, a, calcWAVX2(data, 20));
+    section2CalcAVX2(b, c, d, e, t, a, schedule.getWord(20));
     section2CalcAVX2(a, b, c, d, e, t, data[21]);
     section2CalcAVX2(t, a, b, c, d, e, data[22]);
-    section2CalcAVX2(e, t, a, b, c, d, calcWAVX2(data, 23));
+    section2CalcAVX2(e, t, a, b, c, d, schedule.getWord(23));
     section2CalcAVX2(d, e, t, a, b, c, data[24]);
-    section2CalcAVX2(c, d, e, t, a, b, calcWAVX2(data, 25));
-    section2CalcAVX2(b, c, d, e, t, a, calcWAVX2(data, 26));
+    section2CalcAVX2(c, d, e, t, a, b, schedule.getWord(25));
+    section2CalcAVX2(b, c, d, e, t, a, schedule.getWord(26));
     section2CalcAVX2(a, b, c, d, e, t, data[27]);
-    section2CalcAVX2(t, a, b, c, d, e, calcWAVX2(data, 28));
-    section2CalcAVX2(e, t, a, b, c, d, calcWAVX2(data, 29));
+    section2CalcAVX2(t, a, b, c, d, e, schedule.getWord(28));
+    section2CalcAVX2(e, t, a, b, c, d, schedule.getWord(29));
     section2CalcAVX2(d, e, t, a, b, c, data[30]);
-    section2CalcAVX2(c, d, e, t, a, b, calcWAVX2(data, 31));
-    section2CalcAVX2(b, c, d, e, t, a, calcWAVX2(data, 32));
-    section2CalcAVX2(a, b, c, d, e, t, calcWAVX2(data, 33));
-    section2CalcAVX2(t, a, b, c, d, e, calcWAVX2(data, 34));
-    section2CalcAVX2(e, t, a, b, c, d, calcWAVX2(data, 35));
-    section2CalcAVX2(d, e, t, a, b, c, calcWAVX2(data, 36));
-    section2CalcAVX2(c, d, e, t, a, b, calcWAVX2(data, 37));
-    section2CalcAVX2(b, c, d, e, t, a, calcWAVX2(data, 38));
-    section2CalcAVX2(a, b, c, d, e, t, calcWAVX2(data, 39));
+    section2CalcAVX2(c, d, e, t, a, b, schedule.getWord(31));
+    section2CalcAVX2(b, c, d, e, t, a, schedule.getWord(32));
+    section2CalcAVX2(a, b, c, d, e, t, schedule.getWord(33));
+    section2CalcAVX2(t, a, b, c, d, e, schedule.getWord(34));
+    section2CalcAVX2(e, t, a, b, c, d, schedule.getWord(35));
+    section2CalcAVX2(d, e, t, a, b, c, schedule.getWord(36));
+    section2CalcAVX2(c, d, e, t, a, b, schedule.getWord(37));
+    section2CalcAVX2(b, c, d, e, t, a, schedule.getWord(38));
+    section2CalcAVX2(a, b, c, d, e, t, schedule.getWord(39));
 
     // Section 3: 40 - 59
-    section3CalcAVX2(t, a, b, c, d, e, calcWAVX2(data, 40));
-    section3CalcAVX2(e, t, a, b, c, d, calcWAVX2(data, 41));
-    section3CalcAVX2(d, e, t, a, b, c, calcWAVX2(data, 42));
-    section3CalcAVX2(c, d, e, t, a, b, calcWAVX2(data, 43));
-    section3CalcAVX2(b, c, d, e, t, a, calcWAVX2(data, 44));
-    section3CalcAVX2(a, b, c, d, e, t, calcWAVX2(data, 45));
-    section3CalcAVX2(t, a, b, c, d, e, calcWAVX2(data, 46));
-    section3CalcAVX2(e, t, a, b, c, d, calcWAVX2(data, 47));
-    section3CalcAVX2(d, e, t, a, b, c, calcWAVX2(data, 48));
-    section3CalcAVX2(c, d, e, t, a, b, calcWAVX2(data, 49));
-    section3CalcAVX2(b, c, d, e, t, a, calcWAVX2(data, 50));
-    section3CalcAVX2(a, b, c, d, e, t, calcWAVX2(data, 51));
-    section3CalcAVX2(t, a, b, c, d, e, calcWAVX2(data, 52));
-    section3CalcAVX2(e, t, a, b, c, d, calcWAVX2(data, 53));
-    section3CalcAVX2(d, e, t, a, b, c, calcWAVX2(data, 54));
-    section3CalcAVX2(c, d, e, t, a, b, calcWAVX2(data, 55));
-    section3CalcAVX2(b, c, d, e, t, a, calcWAVX2(data, 56));
-    section3CalcAVX2(a, b, c, d, e, t, calcWAVX2(data, 57));
-    section3CalcAVX2(t, a, b, c, d, e, calcWAVX2(data, 58));
-    section3CalcAVX2(e, t, a, b, c, d, calcWAVX2(data, 59));
+    section3CalcAVX2(t, a, b, c, d, e, schedule.getWord(40));
+    section3CalcAVX2(e, t, a, b, c, d, schedule.getWord(41));
+    section3CalcAVX2(d, e, t, a, b, c, schedule.getWord(42));
+    section3CalcAVX2(c, d, e, t, a, b, schedule.getWord(43));
+    section3CalcAVX2(b, c, d, e, t, a, schedule.getWord(44));
+    section3CalcAVX2(a, b, c, d, e, t, schedule.getWord(45));
+    section3CalcAVX2(t, a, b, c, d, e, schedule.getWord(46));
+    section3CalcAVX2(e, t, a, b, c, d, schedule.getWord(47));
+    section3CalcAVX2(d, e, t, a, b, c, schedule.getWord(48));
+    section3CalcAVX2(c, d, e, t, a, b, schedule.getWord(49));
+    section3CalcAVX2(b, c, d, e, t, a, schedule.getWord(50));
+    section3CalcAVX2(a, b, c, d, e, t, schedule.getWord(51));
+    section3CalcAVX2(t, a, b, c, d, e, schedule.getWord(52));
+    section3CalcAVX2(e, t, a, b, c, d, schedule.getWord(53));
+    section3CalcAVX2(d, e, t, a, b, c, schedule.getWord(54));
+    section3CalcAVX2(c, d, e, t, a, b, schedule.getWord(55));
+    section3CalcAVX2(b, c, d, e, t, a, schedule.getWord(56));
+    section3CalcAVX2(a, b, c, d, e, t, schedule.getWord(57));
+    section3CalcAVX2(t, a, b, c, d, e, schedule.getWord(58));
+    section3CalcAVX2(e, t, a, b, c, d, schedule.getWord(59));
 
     // Section 3: 60 - 79
-    section4CalcAVX2(d, e, t, a, b, c, calcWAVX2(data, 60));
-    section4CalcAVX2(c, d, e, t, a, b, calcWAVX2(data, 61));
-    section4CalcAVX2(b, c, d, e, t, a, calcWAVX2(data, 62));
-    section4CalcAVX2(a, b, c, d, e, t, calcWAVX2(data, 63));
-    section4CalcAVX2(t, a, b, c, d, e, calcWAVX2(data, 64));
-    section4CalcAVX2(e, t, a, b, c, d, calcWAVX2(data, 65));
-    section4CalcAVX2(d, e, t, a, b, c, calcWAVX2(data, 66));
-    section4CalcAVX2(c, d, e, t, a, b, calcWAVX2(data, 67));
-    section4CalcAVX2(b, c, d, e, t, a, calcWAVX2(data, 68));
-    section4CalcAVX2(a, b, c, d, e, t, calcWAVX2(data, 69));
-    section4CalcAVX2(t, a, b, c, d, e, calcWAVX2(data, 70));
-    section4CalcAVX2(e, t, a, b, c, d, calcWAVX2(data, 71));
-    section4CalcAVX2(d, e, t, a, b, c, calcWAVX2(data, 72));
-    section4CalcAVX2(c, d, e, t, a, b, calcWAVX2(data, 73));
-    section4CalcAVX2(b, c, d, e, t, a, calcWAVX2(data, 74));
-    section4CalcAVX2(a, b, c, d, e, t, calcWAVX2(data, 75));
-    section4CalcAVX2(t, a, b, c, d, e, calcWAVX2(data, 76));
-    section4CalcAVX2(e, t, a, b, c, d, calcWAVX2(data, 77));
-    section4CalcAVX2(d, e, t, a, b, c, calcWAVX2(data, 78));
-    section4CalcAVX2(c, d, e, t, a, b, calcWAVX2(data, 79));
+    section4CalcAVX2(d, e, t, a, b, c, schedule.getWord(60));
+    section4CalcAVX2(c, d, e, t, a, b, schedule.getWord(61));
+    section4CalcAVX2(b, c, d, e, t, a, schedule.getWord(62));
+    section4CalcAVX2(a, b, c, d, e, t, schedule.getWord(63));
+    section4CalcAVX2(t, a, b, c, d, e, schedule.getWord(64));
+    section4CalcAVX2(e, t, a, b, c, d, schedule.getWord(65));
+    section4CalcAVX2(d, e, t, a, b, c, schedule.getWord(66));
+    section4CalcAVX2(c, d, e, t, a, b, schedule.getWord(67));
+    section4CalcAVX2(b, c, d, e, t, a, schedule.getWord(68));
+    section4CalcAVX2(a, b, c, d, e, t, schedule.getWord(69));
+    section4CalcAVX2(t, a, b, c, d, e, schedule.getWord(70));
+    section4CalcAVX2(e, t, a, b, c, d, schedule.getWord(71));
+    section4CalcAVX2(d, e, t, a, b, c, schedule.getWord(72));
+    section4CalcAVX2(c, d, e, t, a, b, schedule.getWord(73));
+    section4CalcAVX2(b, c, d, e, t, a, schedule.getWord(74));
+    section4CalcAVX2(a, b, c, d, e, t, schedule.getWord(75));
+    section4CalcAVX2(t, a, b, c, d, e, schedule.getWord(76));
+    section4CalcAVX2(e, t, a, b, c, d, schedule.getWord(77));
+    section4CalcAVX2(d, e, t, a, b, c, schedule.getWord(78));
+    section4CalcAVX2(c, d, e, t, a, b, schedule.getWord(79));
 
     vuint256 part1 = v32x8_byteswap(b + vuint256(0x67452301));
     vuint256 part2 = v32x8_byteswap(c + vuint256(0xefcdab89));
@@ -742,22 +859,36 @@ std::array<vuint256, 5> SHA1AVX2::precompute()
     calcWAVX2(data, 27);
     calcWAVX2(data, 30);
 
+    schedule.reset();
+
     return { d, e, t, a, b };
 }
 
 void SHA1AVX2::setButton(u32 button)
 {
     data[12] = vuint256(button);
+    schedule.reset();
 }
 
 void SHA1AVX2::setDate(const Date &date)
 {
     data[8] = vuint256(dateValues[date.getJD() - Date().getJD()]);
+    schedule.reset();
 }
 
 void SHA1AVX2::setTimer0(u32 timer0, u8 vcount)
 {
     data[5] = vuint256(std::byteswap(static_cast<u32>(vcount << 16) | timer0));
+    schedule.reset();
+}
+
+void SHA1AVX2::setTimer0(u32 timer0, const std::array<u8, 8> &vcount)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        data[5].uint32[i] = std::byteswap(static_cast<u32>(vcount[i] << 16) | timer0);
+    }
+    schedule.reset();
 }
 
 void SHA1AVX2::setTime(u8 hour, u8 minute, u8 second, DSType dsType)
@@ -773,5 +904,74 @@ void SHA1AVX2::setTime(u32 time, DSType dsType)
         val = val ^ 0x40000000;
     }
     data[9] = val;
+    schedule.setTime(time, dsType == DSType::DS3);
+}
+
+void SHA1AVX2::setTime(const std::array<u32, 8> &time, DSType dsType)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        u32 val = timeValues[time[i]];
+        if (time[i] >= 43200 && dsType == DSType::DS3)
+        {
+            val ^= 0x40000000;
+        }
+        data[9].uint32[i] = val;
+    }
+    schedule.setTime();
+}
+
+// Hashing for SHA1AVX512 is in SHA1AVX512.cpp. These only write individual lanes so they do not require AVX512.
+void SHA1AVX512::setButton(u32 button)
+{
+    std::ranges::fill(data[12].uint32, button);
+}
+
+void SHA1AVX512::setDate(const Date &date)
+{
+    std::ranges::fill(data[8].uint32, dateValues[date.getJD() - Date().getJD()]);
+}
+
+void SHA1AVX512::setTimer0(u32 timer0, u8 vcount)
+{
+    std::ranges::fill(data[5].uint32, std::byteswap(static_cast<u32>(vcount << 16) | timer0));
+}
+
+void SHA1AVX512::setTimer0(u32 timer0, const std::array<u8, 16> &vcount)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        data[5].uint32[i] = std::byteswap(static_cast<u32>(vcount[i] << 16) | timer0);
+    }
+}
+
+void SHA1AVX512::setTime(u8 hour, u8 minute, u8 second, DSType dsType)
+{
+    setTime(hour * 3600 + minute * 60 + second, dsType);
+}
+
+void SHA1AVX512::setTime(u32 time, DSType dsType)
+{
+    std::copy_n(&timeValues[time], 16, data[9].uint32);
+    if (time >= 43200 && dsType == DSType::DS3)
+    {
+        for (u32 &val : data[9].uint32)
+        {
+            val ^= 0x40000000;
+        }
+    }
+}
+
+void SHA1AVX512::setTime(const std::array<u32, 16> &time, DSType dsType)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        u32 val = timeValues[time[i]];
+        if (time[i] >= 43200 && dsType == DSType::DS3)
+        {
+            val ^= 0x40000000;
+        }
+        data[9].uint32[i] = val;
+    }
 }
 #endif
@@ -21,6 +21,7 @@
 #define SHA1_HPP
 
 #include <Core/Global.hpp>
+#include <Core/RNG/SHA1Schedule.hpp>
 #include <Core/RNG/SIMD.hpp>
 #include <array>
 
@@ -176,6 +177,14 @@ public:
      */
     void setTimer0(u32 timer0, u8 vcount);
 
+    /**
+     * @brief Sets the SHA1 parameter based on \p timer0 and a different \p vcount for each lane
+     *
+     * @param timer0 Timer0 parameter
+     * @param vcount VCount parameter of each lane
+     */
+    void setTimer0(u32 timer0, const std::array<u8, 4> &vcount);
+
     /**
      * @brief Sets the SHA1 parameter based on time and \p dsType
      *
@@ -194,7 +203,16 @@ public:
      */
     void setTime(u32 time, DSType dsType);
 
+    /**
+     * @brief Sets the SHA1 parameter based on a different \p time for each lane and \p dsType
+     *
+     * @param time Time parameter of each lane
+     * @param dsType DS type parameter
+     */
+    void setTime(const std::array<u32, 4> &time, DSType dsType);
+
 private:
+    SHA1Schedule<vuint128> schedule;
     vuint128 data[80];
 };
 
@@ -261,6 +279,14 @@ public:
      */
     void setTimer0(u32 timer0, u8 vcount);
 
+    /**
+     * @brief Sets the SHA1 parameter based on \p timer0 and a different \p vcount for each lane
+     *
+     * @param timer0 Timer0 parameter
+     * @param vcount VCount parameter of each lane
+     */
+    void setTimer0(u32 timer0, const std::array<u8, 8> &vcount);
+
     /**
      * @brief Sets the SHA1 parameter based on time and \p dsType
      *
@@ -279,9 +305,119 @@ public:
      */
     void setTime(u32 time, DSType dsType);
 
+    /**
+     * @brief Sets the SHA1 parameter based on a different \p time for each lane and \p dsType
+     *
+     * @param time Time parameter of each lane
+     * @param dsType DS type parameter
+     */
+    void setTime(const std::array<u32, 8> &time, DSType dsType);
+
 private:
+    SHA1Schedule<vuint256> schedule;
     vuint256 data[80];
 };
+
+/**
+ * @brief Simplified SHA1 hashing implementation optimized for creating Gen5 initial seeds. Computes 16 seeds at a time.
+ * Hashing is implemented in SHA1AVX512.cpp which is the only source compiled with AVX512 enabled
+ */
+class SHA1AVX512
+{
+public:
+    /**
+     * @brief Construct a new SHA1AVX512 object
+     *
+     * @param profile Profile input parameters
+     */
+    SHA1AVX512(const Profile5 &profile);
+
+    /**
+     * @brief Construct a new SHA1AVX512 object
+     *
+     * @param version Game version parameter
+     * @param language Language parameter
+     * @param type DS type parameter
+     * @param mac MAC address parameter
+     * @param vFrame VFrame parameter
+     * @param gxStat GxStat parameter
+     */
+    SHA1AVX512(Game version, Language language, DSType type, u64 mac, u8 vFrame, u8 gxStat);
+
+    /**
+     * @brief Hashes input parameters from the precomputed \p alpha
+     *
+     * @param alpha Precomputed first 8 rounds alpha
+     *
+     * @return Hashed seed
+     */
+    std::array<u64, 16> hashSeed(const std::array<vuint512, 5> &alpha);
+
+    /**
+     * @brief Precomputes the first 8 rounds of SHA1. Must first call \ref setTimer0() and \ref setDate().
+     * For hashes computed on the same date, the first 8 rounds will be the same.
+     */
+    std::array<vuint512, 5> precompute();
+
+    /**
+     * @brief Sets the SHA1 parameter based on \p button
+     *
+     * @param button Keypress parameter
+     */
+    void setButton(u32 button);
+
+    /**
+     * @brief Sets the SHA1 parameter based on \p date
+     *
+     * @param date Date parameter
+     */
+    void setDate(const Date &date);
+
+    /**
+     * @brief Sets the SHA1 parameter based on \p timer0 and \p vcount
+     *
+     * @param timer0 Timer0 parameter
+     * @param vcount VCount parameter
+     */
+    void setTimer0(u32 timer0, u8 vcount);
+
+    /**
+     * @brief Sets the SHA1 parameter based on \p timer0 and a different \p vcount for each lane
+     *
+     * @param timer0 Timer0 parameter
+     * @param vcount VCount parameter of each lane
+     */
+    void setTimer0(u32 timer0, const std::array<u8, 16> &vcount);
+
+    /**
+     * @brief Sets the SHA1 parameter based on time and \p dsType
+     *
+     * @param hour Hour parameter
+     * @param minute Minute parameter
+     * @param second Second parameter
+     * @param dsType DS type parameter
+     */
+    void setTime(u8 hour, u8 minute, u8 second, DSType dsType);
+
+    /**
+     * @brief Sets the SHA1 parameter based on time and \p dsType
+     *
+     * @param time Time parameter
+     * @param dsType DS type parameter
+     */
+    void setTime(u32 time, DSType dsType);
+
+    /**
+     * @brief Sets the SHA1 parameter based on a different \p time for each lane and \p dsType
+     *
+     * @param time Time parameter of each lane
+     * @param dsType DS type parameter
+     */
+    void setTime(const std::array<u32, 16> &time, DSType dsType);
+
+private:
+    vuint512 data[80];
+};
 #endif
 
 #endif // SHA1_HPP
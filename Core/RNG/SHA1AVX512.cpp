@@ -0,0 +1,224 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SHA1.hpp"
+#include <Core/Gen5/Nazos.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/RNG/LCRNG64.hpp>
+
+#ifdef SIMD_X86
+static vuint512 calcWAVX512(vuint512 *data, int i)
+{
+    vuint512 val = v32x16_rotl<1>(data[i - 3] ^ data[i - 8] ^ data[i - 14] ^ data[i - 16]);
+    data[i] = val;
+    return val;
+}
+
+template <int imm>
+static inline vuint512 ternaryLogic(vuint512 a, vuint512 b, vuint512 c)
+{
+    vuint512 ret;
+    ret.uint512 = _mm512_ternarylogic_epi32(a.uint512, b.uint512, c.uint512, imm);
+    return ret;
+}
+
+static inline void section1CalcAVX512(vuint512 a, vuint512 &b, vuint512 c, vuint512 d, vuint512 e, vuint512 &t, vuint512 input)
+{
+    t = v32x16_rotl<5>(a) + ternaryLogic<0xca>(b, c, d) + e + vuint512(0x5a827999) + input;
+    b = v32x16_rotr<2>(b);
+};
+
+static inline void section2CalcAVX512(vuint512 a, vuint512 &b, vuint512 c, vuint512 d, vuint512 e, vuint512 &t, vuint512 input)
+{
+    t = v32x16_rotl<5>(a) + ternaryLogic<0x96>(b, c, d) + e + vuint512(0x6ed9eba1) + input;
+    b = v32x16_rotr<2>(b);
+};
+
+static inline void section3CalcAVX512(vuint512 a, vuint512 &b, vuint512 c, vuint512 d, vuint512 e, vuint512 &t, vuint512 input)
+{
+    t = v32x16_rotl<5>(a) + ternaryLogic<0xe8>(b, c, d) + e + vuint512(0x8f1bbcdc) + input;
+    b = v32x16_rotr<2>(b);
+};
+
+static inline void section4CalcAVX512(vuint512 a, vuint512 &b, vuint512 c, vuint512 d, vuint512 e, vuint512 &t, vuint512 input)
+{
+    t = v32x16_rotl<5>(a) + ternaryLogic<0x96>(b, c, d) + e + vuint512(0xca62c1d6) + input;
+    b = v32x16_rotr<2>(b);
+};
+
+SHA1AVX512::SHA1AVX512(const Profile5 &profile) :
+    SHA1AVX512(profile.getVersion(), profile.getLanguage(), profile.getDSType(), profile.getMac(), profile.getVFrame(), profile.getGxStat())
+{
+}
+
+SHA1AVX512::SHA1AVX512(Game version, Language language, DSType type, u64 mac, u8 vFrame, u8 gxStat)
+{
+    auto nazos = Nazos::getNazo(version, language, type);
+    for (int i = 0; i < nazos.size(); i++)
+    {
+        data[i] = vuint512(nazos[i]);
+    }
+
+    data[6] = vuint512(mac & 0xffff);
+    data[7] = vuint512(static_cast<u32>((mac >> 16) ^ static_cast<u32>(vFrame << 24) ^ gxStat));
+
+    // Set values
+    data[10] = vuint512(0x00000000);
+    data[11] = vuint512(0x00000000);
+    data[13] = vuint512(0x80000000);
+    data[14] = vuint512(0x00000000);
+    data[15] = vuint512(0x000001a0);
+
+    // Precompute data[18]
+    calcWAVX512(data, 18);
+}
+
+std::array<u64, 16> SHA1AVX512::hashSeed(const std::array<vuint512, 5> &alpha)
+{
+    vuint512 a = alpha[0];
+    vuint512 b = alpha[1];
+    vuint512 c = alpha[2];
+    vuint512 d = alpha[3];
+    vuint512 e = alpha[4];
+    vuint512 t;
+
+    // Section 1: 0-19
+    // 0-8 already computed
+    section1CalcAVX512(a, b, c, d, e, t, data[9]);
+    section1CalcAVX512(t, a, b, c, d, e, data[10]);
+    section1CalcAVX512(e, t, a, b, c, d, data[11]);
+    section1CalcAVX512(d, e, t, a, b, c, data[12]);
+    section1CalcAVX512(c, d, e, t, a, b, data[13]);
+    section1CalcAVX512(b, c, d, e, t, a, data[14]);
+    section1CalcAVX512(a, b, c, d, e, t, data[15]);
+    section1CalcAVX512(t, a, b, c, d, e, data[16]);
+    section1CalcAVX512(e, t, a, b, c, d, calcWAVX512(data, 17));
+    section1CalcAVX512(d, e, t, a, b, c, data[18]);
+    section1CalcAVX512(c, d, e, t, a, b, data[19]);
+
+    // Section 2: 20 - 39
+    section2CalcAVX512(b, c, d, e, t, a, calcWAVX512(data, 20));
+    section2CalcAVX512(a, b, c, d, e, t, data[21]);
+    section2CalcAVX512(t, a, b, c, d, e, data[22]);
+    section2CalcAVX512(e, t, a, b, c, d, calcWAVX512(data, 23));
+    section2CalcAVX512(d, e, t, a, b, c, data[24]);
+    section2CalcAVX512(c, d, e, t, a, b, calcWAVX512(data, 25));
+    section2CalcAVX512(b, c, d, e, t, a, calcWAVX512(data, 26));
+    section2CalcAVX512(a, b, c, d, e, t, data[27]);
+    section2CalcAVX512(t, a, b, c, d, e, calcWAVX512(data, 28));
+    section2CalcAVX512(e, t, a, b, c, d, calcWAVX512(data, 29));
+    section2CalcAVX512(d, e, t, a, b, c, data[30]);
+    section2CalcAVX512(c, d, e, t, a, b, calcWAVX512(data, 31));
+    section2CalcAVX512(b, c, d, e, t, a, calcWAVX512(data, 32));
+    section2CalcAVX512(a, b, c, d, e, t, calcWAVX512(data, 33));
+    section2CalcAVX512(t, a, b, c, d, e, calcWAVX512(data, 34));
+    section2CalcAVX512(e, t, a, b, c, d, calcWAVX512(data, 35));
+    section2CalcAVX512(d, e, t, a, b, c, calcWAVX512(data, 36));
+    section2CalcAVX512(c, d, e, t, a, b, calcWAVX512(data, 37));
+    section2CalcAVX512(b, c, d, e, t, a, calcWAVX512(data, 38));
+    section2CalcAVX512(a, b, c, d, e, t, calcWAVX512(data, 39));
+
+    // Section 3: 40 - 59
+    section3CalcAVX512(t, a, b, c, d, e, calcWAVX512(data, 40));
+    section3CalcAVX512(e, t, a, b, c, d, calcWAVX512(data, 41));
+    section3CalcAVX512(d, e, t, a, b, c, calcWAVX512(data, 42));
+    section3CalcAVX512(c, d, e, t, a, b, calcWAVX512(data, 43));
+    section3CalcAVX512(b, c, d, e, t, a, calcWAVX512(data, 44));
+    section3CalcAVX512(a, b, c, d, e, t, calcWAVX512(data, 45));
+    section3CalcAVX512(t, a, b, c, d, e, calcWAVX512(data, 46));
+    section3CalcAVX512(e, t, a, b, c, d, calcWAVX512(data, 47));
+    section3CalcAVX512(d, e, t, a, b, c, calcWAVX512(data, 48));
+    section3CalcAVX512(c, d, e, t, a, b, calcWAVX512(data, 49));
+    section3CalcAVX512(b, c, d, e, t, a, calcWAVX512(data, 50));
+    section3CalcAVX512(a, b, c, d, e, t, calcWAVX512(data, 51));
+    section3CalcAVX512(t, a, b, c, d, e, calcWAVX512(data, 52));
+    section3CalcAVX512(e, t, a, b, c, d, calcWAVX512(data, 53));
+    section3CalcAVX512(d, e, t, a, b, c, calcWAVX512(data, 54));
+    section3CalcAVX512(c, d, e, t, a, b, calcWAVX512(data, 55));
+    section3CalcAVX512(b, c, d, e, t, a, calcWAVX512(data, 56));
+    section3CalcAVX512(a, b, c, d, e, t, calcWAVX512(data, 57));
+    section3CalcAVX512(t, a, b, c, d, e, calcWAVX512(data, 58));
+    section3CalcAVX512(e, t, a, b, c, d, calcWAVX512(data, 59));
+
+    // Section 3: 60 - 79
+    section4CalcAVX512(d, e, t, a, b, c, calcWAVX512(data, 60));
+    section4CalcAVX512(c, d, e, t, a, b, calcWAVX512(data, 61));
+    section4CalcAVX512(b, c, d, e, t, a, calcWAVX512(data, 62));
+    section4CalcAVX512(a, b, c, d, e, t, calcWAVX512(data, 63));
+    section4CalcAVX512(t, a, b, c, d, e, calcWAVX512(data, 64));
+    section4CalcAVX512(e, t, a, b, c, d, calcWAVX512(data, 65));
+    section4CalcAVX512(d, e, t, a, b, c, calcWAVX512(data, 66));
+    section4CalcAVX512(c, d, e, t, a, b, calcWAVX512(data, 67));
+    section4CalcAVX512(b, c, d, e, t, a, calcWAVX512(data, 68));
+    section4CalcAVX512(a, b, c, d, e, t, calcWAVX512(data, 69));
+    section4CalcAVX512(t, a, b, c, d, e, calcWAVX512(data, 70));
+    section4CalcAVX512(e, t, a, b, c, d, calcWAVX512(data, 71));
+    section4CalcAVX512(d, e, t, a, b, c, calcWAVX512(data, 72));
+    section4CalcAVX512(c, d, e, t, a, b, calcWAVX512(data, 73));
+    section4CalcAVX512(b, c, d, e, t, a, calcWAVX512(data, 74));
+    section4CalcAVX512(a, b, c, d, e, t, calcWAVX512(data, 75));
+    section4CalcAVX512(t, a, b, c, d, e, calcWAVX512(data, 76));
+    section4CalcAVX512(e, t, a, b, c, d, calcWAVX512(data, 77));
+    section4CalcAVX512(d, e, t, a, b, c, calcWAVX512(data, 78));
+    section4CalcAVX512(c, d, e, t, a, b, calcWAVX512(data, 79));
+
+    vuint512 part1 = v32x16_byteswap(b + vuint512(0x67452301));
+    vuint512 part2 = v32x16_byteswap(c + vuint512(0xefcdab89));
+
+    std::array<u64, 16> seeds;
+    for (int i = 0; i < seeds.size(); i++)
+    {
+        u64 seed = (static_cast<u64>(part2[i]) << 32) | static_cast<u64>(part1[i]);
+        seeds[i] = BWRNG(seed).next();
+    }
+
+    return seeds;
+}
+
+std::array<vuint512, 5> SHA1AVX512::precompute()
+{
+    vuint512 a(0x67452301);
+    vuint512 b(0xefcdab89);
+    vuint512 c(0x98badcfe);
+    vuint512 d(0x10325476);
+    vuint512 e(0xc3d2e1f0);
+    vuint512 t;
+
+    section1CalcAVX512(a, b, c, d, e, t, data[0]);
+    section1CalcAVX512(t, a, b, c, d, e, data[1]);
+    section1CalcAVX512(e, t, a, b, c, d, data[2]);
+    section1CalcAVX512(d, e, t, a, b, c, data[3]);
+    section1CalcAVX512(c, d, e, t, a, b, data[4]);
+    section1CalcAVX512(b, c, d, e, t, a, data[5]);
+    section1CalcAVX512(a, b, c, d, e, t, data[6]);
+    section1CalcAVX512(t, a, b, c, d, e, data[7]);
+    section1CalcAVX512(e, t, a, b, c, d, data[8]);
+
+    // Select values will be the same for same date
+    calcWAVX512(data, 16);
+    calcWAVX512(data, 19);
+    calcWAVX512(data, 21);
+    calcWAVX512(data, 22);
+    calcWAVX512(data, 24);
+    calcWAVX512(data, 27);
+    calcWAVX512(data, 30);
+
+    return { d, e, t, a, b };
+}
+#endif
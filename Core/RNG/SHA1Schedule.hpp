@@ -0,0 +1,211 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SHA1SCHEDULE_HPP
+#define SHA1SCHEDULE_HPP
+
+#include <Core/Global.hpp>
+#include <algorithm>
+#include <array>
+
+/**
+ * @brief Contributions of the time parameter to the SHA1 message schedule.
+ * The message schedule only uses xor and rotations, so each of words 16-79 is the xor of what every input word contributes.
+ * The time parameter is the xor of the hour/minute and second values, so these can be tabled separately.
+ */
+namespace SHA1ScheduleTables
+{
+    /**
+     * @brief Gets the message schedule contribution of the hour and minute
+     *
+     * @param minute Minute of the day
+     *
+     * @return Contribution to words 16-79
+     */
+    const std::array<u32, 64> &getMinute(u16 minute);
+
+    /**
+     * @brief Gets the message schedule contribution of the PM flag the DS3 sets for the afternoon
+     *
+     * @return Contribution to words 16-79
+     */
+    const std::array<u32, 64> &getPM();
+
+    /**
+     * @brief Gets the message schedule contribution of the seconds of consecutive times.
+     * Every 15 batches of \p lanes times the seconds of each lane repeat.
+     *
+     * @param lanes Number of consecutive times per batch, either 4 or 8
+     * @param phase Batch index modulo 15
+     *
+     * @return Contribution to words 16-79, stored as 64 groups of \p lanes values
+     */
+    const u32 *getSecond(u8 lanes, u8 phase);
+}
+
+/**
+ * @brief Computes the time dependent words of the SHA1 message schedule for SHA1SSE and SHA1AVX2.
+ * When times are searched in order the schedule is split into the part from every other input, the hour/minute part, and the second
+ * part. The first is cached until another input changes, the second until the minute changes, and the last is read from a table.
+ * This leaves a single xor per word for each hash. SHA1AVX512 does not use this since its 16 lane second table does not fit in L1 and
+ * ternary logic already makes the normal schedule cheap.
+ *
+ * @tparam Vector SIMD vector type
+ */
+template <class Vector>
+class SHA1Schedule
+{
+public:
+    static constexpr u8 lanes = sizeof(Vector) / sizeof(u32);
+
+    /**
+     * @brief Clears the cached schedule. Must be called whenever an input other than the time changes.
+     */
+    void reset()
+    {
+        valid = false;
+    }
+
+    /**
+     * @brief Sets the times that are hashed next
+     *
+     * @param time Time of the first lane, with each other lane being one second later
+     * @param pm Whether the PM flag is set for the afternoon
+     */
+    void setTime(u32 time, bool pm)
+    {
+        this->time = time;
+        this->pm = pm;
+        aligned = time % lanes == 0;
+    }
+
+    /**
+     * @brief Sets that the times of each lane are unrelated, which requires the full schedule to be computed
+     */
+    void setTime()
+    {
+        aligned = false;
+    }
+
+    /**
+     * @brief Prepares the time dependent words of the message schedule for the set times
+     *
+     * @param data Message schedule
+     */
+    void compute(const Vector *data)
+    {
+        if (!aligned)
+        {
+            Vector w[80];
+            std::copy(data, data + 16, w);
+            for (u8 i = 16; i < 80; i++)
+            {
+                w[i] = calcW(w, i);
+                base[i - 16] = w[i];
+            }
+
+            second = reinterpret_cast<const Vector *>(zero);
+            minutes = 0xffffffff;
+            return;
+        }
+
+        if (!valid)
+        {
+            Vector w[80];
+            std::copy(data, data + 16, w);
+            w[9] = Vector(0);
+            for (u8 i = 16; i < 80; i++)
+            {
+                w[i] = calcW(w, i);
+                constant[i - 16] = w[i];
+            }
+
+            seconds = reinterpret_cast<const Vector *>(SHA1ScheduleTables::getSecond(lanes, 0));
+            valid = true;
+            minutes = 0xffffffff;
+        }
+
+        u16 first = time / 60;
+        u16 last = (time + lanes - 1) / 60;
+        u32 key = (static_cast<u32>(pm) << 31) | (first << 16) | last;
+        if (minutes != key)
+        {
+            minutes = key;
+
+            Vector mask;
+            for (u8 i = 0; i < lanes; i++)
+            {
+                mask.uint32[i] = (time + i) / 60 == first ? 0 : 0xffffffff;
+            }
+
+            const auto &low = SHA1ScheduleTables::getMinute(first);
+            const auto &high = SHA1ScheduleTables::getMinute(last);
+            const auto &flag = SHA1ScheduleTables::getPM();
+            for (u8 i = 0; i < 64; i++)
+            {
+                u32 lowVal = low[i] ^ (pm && first >= 720 ? flag[i] : 0);
+                u32 highVal = high[i] ^ (pm && last >= 720 ? flag[i] : 0);
+                base[i] = constant[i] ^ Vector(lowVal) ^ (mask & Vector(lowVal ^ highVal));
+            }
+        }
+
+        second = seconds + ((time % (lanes * 15)) / lanes) * 64;
+    }
+
+    /**
+     * @brief Gets word \p i of the message schedule. Must first call \ref compute().
+     *
+     * @param i Word index
+     *
+     * @return Message schedule word
+     */
+    Vector getWord(u8 i) const
+    {
+        return base[i - 16] ^ second[i - 16];
+    }
+
+private:
+    alignas(64) static inline const u32 zero[64 * lanes] = {};
+
+    Vector constant[64];
+    Vector base[64];
+    const Vector *second;
+    const Vector *seconds;
+    u32 minutes;
+    u32 time;
+    bool aligned = false;
+    bool pm;
+    bool valid = false;
+
+    /**
+     * @brief Computes word \p i of the message schedule
+     *
+     * @param data Message schedule
+     * @param i Word index
+     *
+     * @return Computed word
+     */
+    static Vector calcW(const Vector *data, u8 i)
+    {
+        Vector val = data[i - 3] ^ data[i - 8] ^ data[i - 14] ^ data[i - 16];
+        return (val << 1) | (val >> 31);
+    }
+};
+
+#endif // SHA1SCHEDULE_HPP
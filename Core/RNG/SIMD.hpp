@@ -32,6 +32,7 @@
 #include <cpuid.h>
 #endif
 
+using vuint32x16 = __m512i;
 using vuint32x8 = __m256i;
 using vuint32x4 = __m128i;
 #elif defined(SIMD) && (defined(__arm__) || defined(_M_ARM) || defined(__aarch64__))
@@ -146,6 +147,29 @@ union alignas(16) vuint128 {
         return ret;
     }
 
+    /**
+     * @brief Computes the lower 32bits of the multiplication of each 32bit number pair in the vector
+     *
+     * @param y Second operand
+     *
+     * @return Computed multiplication vector
+     */
+    inline vuint128 operator*(vuint128 y) const
+    {
+        vuint128 ret;
+#if defined(SIMD_X86)
+        ret.uint128 = _mm_mullo_epi32(uint128, y.uint128);
+#elif defined(SIMD_ARM)
+        ret.uint128 = vmulq_u32(uint128, y.uint128);
+#else
+        for (int i = 0; i < 4; i++)
+        {
+            ret.uint32[i] = uint32[i] * y.uint32[i];
+        }
+#endif
+        return ret;
+    }
+
     /**
      * @brief Computes the bitwise left shift of each 32bit number pair in the vector
      *
@@ -642,14 +666,18 @@ inline vuint128 v128_shr(vuint128 x)
 #if defined(SIMD_X86)
 inline bool hasAVX2()
 {
-    int info[4];
+    // Searchers query this per work tile, only execute cpuid once
+    static const bool avx2 = [] {
+        int info[4];
 #ifdef _MSC_VER
-    __cpuidex(info, 7, 0); // EAX=7, ECX=0 for extended features
+        __cpuidex(info, 7, 0); // EAX=7, ECX=0 for extended features
 #else
-    __cpuid_count(7, 0, info[0], info[1], info[2], info[3]);
+        __cpuid_count(7, 0, info[0], info[1], info[2], info[3]);
 #endif
-    // Check bit 5 of EBX for AVX2 support
-    return (info[1] & (1 << 5)) != 0;
+        // Check bit 5 of EBX for AVX2 support
+        return (info[1] & (1 << 5)) != 0;
+    }();
+    return avx2;
 }
 
 union alignas(32) vuint256 {
@@ -708,6 +736,20 @@ union alignas(32) vuint256 {
         return ret;
     }
 
+    /**
+     * @brief Computes the lower 32bits of the multiplication of each 32bit number pair in the vector
+     *
+     * @param y Second operand
+     *
+     * @return Computed multiplication vector
+     */
+    inline vuint256 operator*(vuint256 y) const
+    {
+        vuint256 ret;
+        ret.uint256 = _mm256_mullo_epi32(uint256, y.uint256);
+        return ret;
+    }
+
     /**
      * @brief Computes the bitwise left shift of each 32bit number pair in the vector
      *
@@ -850,6 +892,252 @@ inline vuint256 v32x8_rotr(vuint256 x)
 {
     return (x >> rotate) | (x << (32 - rotate));
 }
+
+inline bool hasAVX512()
+{
+    // Searchers query this per work tile, only execute cpuid once
+    static const bool avx512 = [] {
+        int info[4];
+#ifdef _MSC_VER
+        __cpuidex(info, 7, 0); // EAX=7, ECX=0 for extended features
+#else
+        __cpuid_count(7, 0, info[0], info[1], info[2], info[3]);
+#endif
+        // Check bit 16 (AVX512F) and bit 30 (AVX512BW) of EBX
+        if ((info[1] & (1 << 16)) == 0 || (info[1] & (1 << 30)) == 0)
+        {
+            return false;
+        }
+
+#ifdef _MSC_VER
+        __cpuidex(info, 1, 0);
+#else
+        __cpuid_count(1, 0, info[0], info[1], info[2], info[3]);
+#endif
+        // Check bit 27 (OSXSAVE) of ECX before XGETBV can be used
+        if ((info[2] & (1 << 27)) == 0)
+        {
+            return false;
+        }
+
+        // The OS has to save the SSE, AVX, opmask, and upper ZMM registers (XCR0 bits 1, 2, 5, 6, and 7)
+#ifdef _MSC_VER
+        u64 xcr0 = _xgetbv(0);
+#else
+        u32 eax, edx;
+        __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        u64 xcr0 = (static_cast<u64>(edx) << 32) | eax;
+#endif
+        return (xcr0 & 0xe6) == 0xe6;
+    }();
+    return avx512;
+}
+
+// Only usable from translation units compiled with AVX512F/AVX512BW enabled
+union alignas(64) vuint512 {
+    vuint32x16 uint512;
+    u64 uint64[8];
+    u32 uint32[16];
+
+    /**
+     * @brief Construct a new vuint512 object
+     */
+    vuint512() = default;
+
+    /**
+     * @brief Construct a new vuint512 object
+     *
+     * @param x Initalization number
+     */
+    vuint512(u32 x)
+    {
+        uint512 = _mm512_set1_epi32(x);
+    }
+
+    /**
+     * @brief Returns reference to u32 data element
+     *
+     * @param i Index
+     */
+    inline u32 &operator[](int i)
+    {
+        return uint32[i];
+    }
+
+    /**
+     * @brief Computes the bitwise NOT of each 32bit number pair in the vector
+     *
+     * @return Computed bitwise NOT vector
+     */
+    inline vuint512 operator~() const
+    {
+        vuint512 ret;
+        ret.uint512 = _mm512_ternarylogic_epi32(uint512, uint512, uint512, 0x55);
+        return ret;
+    }
+
+    /**
+     * @brief Computes the bitwise ADD of each 32bit number pair in the vector
+     *
+     * @param y Second operand
+     *
+     * @return Computed bitwise ADD vector
+     */
+    inline vuint512 operator+(vuint512 y) const
+    {
+        vuint512 ret;
+        ret.uint512 = _mm512_add_epi32(uint512, y.uint512);
+        return ret;
+    }
+
+    /**
+     * @brief Computes the bitwise left shift of each 32bit number pair in the vector
+     *
+     * @param shift Amount to shift by
+     *
+     * @return Computed bitwise left shift vector
+     */
+    inline vuint512 operator<<(int shift) const
+    {
+        vuint512 ret;
+        ret.uint512 = _mm512_slli_epi32(uint512, shift);
+        return ret;
+    }
+
+    /**
+     * @brief Computes the bitwise right shift of each 32bit number pair in the vector
+     *
+     * @param shift Amount to shift by
+     *
+     * @return Computed bitwise right shift vector
+     */
+    inline vuint512 operator>>(int shift) const
+    {
+        vuint512 ret;
+        ret.uint512 = _mm512_srli_epi32(uint512, shift);
+        return ret;
+    }
+
+    /**
+     * @brief Compares each 32bit number pair in the vector for equality. Assigns 0xFFFFFFFF on equal and 0 when not
+     *
+     * @param y Second operand
+     *
+     * @return Computed equality vector
+     */
+    inline vuint512 operator==(vuint512 y) const
+    {
+        vuint512 ret;
+        ret.uint512 = _mm512_maskz_mov_epi32(_mm512_cmpeq_epi32_mask(uint512, y.uint512), _mm512_set1_epi32(-1));
+        return ret;
+    }
+
+    /**
+     * @brief Computes the bitwise AND of each 32bit number pair in the vector
+     *
+     * @param y Second operand
+     *
+     * @return Computed bitwise AND vector
+     */
+    inline vuint512 operator&(vuint512 y) const
+    {
+        vuint512 ret;
+        ret.uint512 = _mm512_and_si512(uint512, y.uint512);
+        return ret;
+    }
+
+    /**
+     * @brief Computes the bitwise XOR of each 32bit number pair in the vector
+     *
+     * @param y Second operand
+     *
+     * @return Computed bitwise XOR vector
+     */
+    inline vuint512 operator^(vuint512 y) const
+    {
+        vuint512 ret;
+        ret.uint512 = _mm512_xor_si512(uint512, y.uint512);
+        return ret;
+    }
+
+    /**
+     * @brief Computes the bitwise OR of each 32bit number pair in the vector
+     *
+     * @param y Second operand
+     *
+     * @return Computed bitwise OR vector
+     */
+    inline vuint512 operator|(vuint512 y) const
+    {
+        vuint512 ret;
+        ret.uint512 = _mm512_or_si512(uint512, y.uint512);
+        return ret;
+    }
+};
+
+/**
+ * @brief Computes the byteswap of each 32bit number pair in the vector
+ *
+ * @param x Input vector
+ *
+ * @return Computed byteswap vector
+ */
+inline vuint512 v32x16_byteswap(vuint512 x)
+{
+    vuint512 ret;
+    ret.uint512 = _mm512_shuffle_epi8(
+        x.uint512,
+        _mm512_set_epi8(60, 61, 62, 63, 56, 57, 58, 59, 52, 53, 54, 55, 48, 49, 50, 51, 44, 45, 46, 47, 40, 41, 42, 43, 36, 37, 38, 39, 32,
+                        33, 34, 35, 28, 29, 30, 31, 24, 25, 26, 27, 20, 21, 22, 23, 16, 17, 18, 19, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6,
+                        7, 0, 1, 2, 3));
+    return ret;
+}
+
+/**
+ * @brief Loads vector from memory
+ *
+ * @param address Memory address
+ *
+ * @return Loaded vector
+ */
+inline vuint512 v32x16_load(const u32 *address)
+{
+    vuint512 ret;
+    ret.uint512 = _mm512_loadu_si512(address);
+    return ret;
+}
+
+/**
+ * @brief Computes the bitwise rotate left of each 32bit number pair in the vector
+ *
+ * @tparam rotate Amount to rotateby
+ * @param x Input vector
+ *
+ * @return Computed bitwise rotate left vector
+ */
+template <int rotate>
+inline vuint512 v32x16_rotl(vuint512 x)
+{
+    vuint512 ret;
+    ret.uint512 = _mm512_rol_epi32(x.uint512, rotate);
+    return ret;
+}
+
+/**
+ * @brief Computes the bitwise rotate right of each 32bit number pair in the vector
+ *
+ * @tparam rotate Amount to rotateby
+ * @param x Input vector
+ *
+ * @return Computed bitwise rotate right vector
+ */
+template <int rotate>
+inline vuint512 v32x16_rotr(vuint512 x)
+{
+    vuint512 ret;
+    ret.uint512 = _mm512_ror_epi32(x.uint512, rotate);
+    return ret;
+}
 #endif
 
 #endif // SIMD_HPP
@@ -24,6 +24,7 @@
 #include <Core/RNG/LCRNG.hpp>
 #include <Core/RNG/MT.hpp>
 #include <Core/Util/DateTime.hpp>
+#include <algorithm>
 #include <zstd.h>
 
 static u32 advanceProbabilityTable(BWRNG &rng)
@@ -69,6 +70,269 @@ static u32 advanceProbabilityTable(BWRNG &rng)
     return count;
 }
 
+/**
+ * @brief Walks 4 PRNG states through the probability tables in lockstep without branching
+ */
+class ProbabilityLanes
+{
+public:
+    /**
+     * @brief Construct a new ProbabilityLanes object
+     *
+     * @param seeds Starting PRNG state of each lane
+     */
+    ProbabilityLanes(const std::array<u64, 4> &seeds) : seeds(seeds), advances {}
+    {
+    }
+
+    /**
+     * @brief Advances every lane by \p advances amount without counting them
+     *
+     * @param advances Number of advances
+     */
+    void advance(u32 advances)
+    {
+        for (u64 &seed : seeds)
+        {
+            seed = BWRNG(seed, advances).getSeed();
+        }
+    }
+
+    /**
+     * @brief Draws from the probability table with the lanes in \p active
+     *
+     * @param active Bitmask of lanes to advance
+     * @param threshold Value the roll has to be above to continue
+     *
+     * @return Bitmask of the advanced lanes that rolled above \p threshold
+     */
+    u32 draw(u32 active, u32 threshold)
+    {
+        // Lanes that are not drawing advance by the identity so that no lane has to branch
+        static constexpr u64 mults[2] = { 1, BWRNG::getMult() };
+        static constexpr u64 adds[2] = { 0, BWRNG::getAdd() };
+
+        u32 pass = 0;
+        for (u8 i = 0; i < 4; i++)
+        {
+            u32 take = (active >> i) & 1;
+            seeds[i] = seeds[i] * mults[take] + adds[take];
+            advances[i] += take;
+            pass |= static_cast<u32>((((seeds[i] >> 32) * 101) >> 32) > threshold) << i;
+        }
+        return active & pass;
+    }
+
+    /**
+     * @brief Draws 3 values below 15 with the lanes in \p active
+     *
+     * @param active Bitmask of lanes to advance
+     *
+     * @return Bitmask of the advanced lanes that drew a duplicate value
+     */
+    u32 drawRepeat(u32 active)
+    {
+        u32 repeat = 0;
+        for (u8 i = 0; i < 4; i++)
+        {
+            if (active & (1 << i))
+            {
+                BWRNG rng(seeds[i]);
+                u8 rand1 = rng.nextUInt(15);
+                u8 rand2 = rng.nextUInt(15);
+                u8 rand3 = rng.nextUInt(15);
+
+                seeds[i] = rng.getSeed();
+                advances[i] += 3;
+                repeat |= static_cast<u32>(rand1 == rand2 || rand1 == rand3 || rand2 == rand3) << i;
+            }
+        }
+        return repeat;
+    }
+
+    /**
+     * @brief Returns the counted advances of each lane
+     *
+     * @return Advance counts
+     */
+    std::array<u32, 4> getAdvances() const
+    {
+        return advances;
+    }
+
+private:
+    std::array<u64, 4> seeds;
+    std::array<u32, 4> advances;
+};
+
+#ifdef SIMD_X86
+/**
+ * @brief Walks 4 PRNG states through the probability tables with AVX2. Must only be used when hasAVX2() is true.
+ */
+class ProbabilityLanesAVX2
+{
+public:
+    /**
+     * @brief Construct a new ProbabilityLanesAVX2 object
+     *
+     * @param seeds Starting PRNG state of each lane
+     */
+    ProbabilityLanesAVX2(const std::array<u64, 4> &seeds) : rng(seeds.data()), advances(_mm256_setzero_si256())
+    {
+    }
+
+    /**
+     * @brief Advances every lane by \p advances amount without counting them
+     *
+     * @param advances Number of advances
+     */
+    void advance(u32 advances)
+    {
+        rng.advance(advances);
+    }
+
+    /**
+     * @brief Draws from the probability table with the lanes in \p active
+     *
+     * @param active Bitmask of lanes to advance
+     * @param threshold Value the roll has to be above to continue
+     *
+     * @return Bitmask of the advanced lanes that rolled above \p threshold
+     */
+    u32 draw(u32 active, u32 threshold)
+    {
+        vuint256 mask = getMask(active);
+        vuint256 rand = rng.nextUInt(101, mask);
+        advances = _mm256_sub_epi64(advances, mask.uint256);
+        return active & _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(rand.uint256, _mm256_set1_epi64x(threshold))));
+    }
+
+    /**
+     * @brief Draws 3 values below 15 with the lanes in \p active
+     *
+     * @param active Bitmask of lanes to advance
+     *
+     * @return Bitmask of the advanced lanes that drew a duplicate value
+     */
+    u32 drawRepeat(u32 active)
+    {
+        vuint256 mask = getMask(active);
+        __m256i rand1 = rng.nextUInt(15, mask).uint256;
+        __m256i rand2 = rng.nextUInt(15, mask).uint256;
+        __m256i rand3 = rng.nextUInt(15, mask).uint256;
+        advances = _mm256_sub_epi64(advances, _mm256_and_si256(mask.uint256, _mm256_set1_epi64x(-3)));
+
+        __m256i repeat = _mm256_or_si256(_mm256_cmpeq_epi64(rand1, rand2),
+                                         _mm256_or_si256(_mm256_cmpeq_epi64(rand1, rand3), _mm256_cmpeq_epi64(rand2, rand3)));
+        return active & _mm256_movemask_pd(_mm256_castsi256_pd(repeat));
+    }
+
+    /**
+     * @brief Returns the counted advances of each lane
+     *
+     * @return Advance counts
+     */
+    std::array<u32, 4> getAdvances() const
+    {
+        alignas(32) u64 counts[4];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(counts), advances);
+        return { static_cast<u32>(counts[0]), static_cast<u32>(counts[1]), static_cast<u32>(counts[2]), static_cast<u32>(counts[3]) };
+    }
+
+private:
+    BWRNGMulti rng;
+    __m256i advances;
+
+    /**
+     * @brief Expands a bitmask of lanes to a vector mask
+     *
+     * @param active Bitmask of lanes
+     *
+     * @return Vector with each selected 64bit lane being all ones
+     */
+    static vuint256 getMask(u32 active)
+    {
+        __m256i bits = _mm256_set_epi64x(8, 4, 2, 1);
+
+        vuint256 mask;
+        mask.uint256 = _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(active), bits), bits);
+        return mask;
+    }
+};
+#endif
+
+/**
+ * @brief Advances each lane through the probability table
+ *
+ * @tparam Lanes Lane implementation
+ * @param lanes PRNG lanes
+ */
+template <class Lanes>
+static void advanceProbabilityTable(Lanes &lanes)
+{
+    // Every lane draws until its roll fails, and the lanes that passed every roll advance once more
+
+    // Round 1: 50, 100
+    lanes.draw(0xf, 0);
+
+    // Round 2: 50, 50, 100
+    lanes.draw(lanes.draw(0xf, 50), 0);
+
+    // Round 3: 30, 50, 100
+    lanes.draw(lanes.draw(0xf, 30), 0);
+
+    // Round 4: 25, 30, 50, 100
+    lanes.draw(lanes.draw(lanes.draw(0xf, 25), 30), 0);
+
+    // Round 5: 20, 25, 33, 50, 100
+    lanes.draw(lanes.draw(lanes.draw(lanes.draw(0xf, 20), 25), 33), 0);
+}
+
+/**
+ * @brief Computes the initial advances of \p seeds 4 at a time
+ *
+ * @tparam Function Function type
+ * @param seeds PRNG states
+ * @param count Number of PRNG states
+ * @param offset Advances that are the same for every seed
+ * @param advances Initial advance count of each seed
+ * @param compute Function that walks the lanes through the initial advances
+ */
+template <class Function>
+static void computeLanes(const u64 *seeds, u8 count, u32 offset, u32 *advances, Function compute)
+{
+    for (u8 start = 0; start < count; start += 4)
+    {
+        // Repeat the last seed in unused lanes
+        std::array<u64, 4> states;
+        for (u8 i = 0; i < 4; i++)
+        {
+            states[i] = seeds[std::min(start + i, count - 1)];
+        }
+
+        std::array<u32, 4> counts;
+#ifdef SIMD_X86
+        if (hasAVX2())
+        {
+            ProbabilityLanesAVX2 lanes(states);
+            compute(lanes);
+            counts = lanes.getAdvances();
+        }
+        else
+#endif
+        {
+            ProbabilityLanes lanes(states);
+            compute(lanes);
+            counts = lanes.getAdvances();
+        }
+
+        for (u8 i = 0; i < 4 && start + i < count; i++)
+        {
+            advances[start + i] = counts[i] + offset;
+        }
+    }
+}
+
 static std::string getPitch(u8 result)
 {
     std::string pitch;
@@ -98,6 +362,66 @@ static std::string getPitch(u8 result)
 
 namespace Utilities
 {
+    template <typename Type>
+    std::vector<u8> compressValues(const Type *values, u32 count, bool delta)
+    {
+        std::vector<u8> planes(count * sizeof(Type));
+        for (u32 i = 0; i < count; i++)
+        {
+            Type value = delta && i != 0 ? values[i] - values[i - 1] : values[i];
+            for (u32 j = 0; j < sizeof(Type); j++)
+            {
+                planes[j * count + i] = value >> (j * 8);
+            }
+        }
+
+        std::vector<u8> data(ZSTD_compressBound(planes.size()));
+        size_t size = ZSTD_compress(data.data(), data.size(), planes.data(), planes.size(), ZSTD_CLEVEL_DEFAULT);
+        data.resize(ZSTD_isError(size) ? 0 : size);
+
+        return data;
+    }
+
+    template <typename Type>
+    bool decompressValues(const u8 *compressedData, u32 compressedSize, Type *values, u32 count, bool delta)
+    {
+        std::vector<u8> planes(count * sizeof(Type));
+        size_t size = ZSTD_decompress(planes.data(), planes.size(), compressedData, compressedSize);
+        if (ZSTD_isError(size) || size != planes.size())
+        {
+            return false;
+        }
+
+        Type previous = 0;
+        for (u32 i = 0; i < count; i++)
+        {
+            Type value = 0;
+            for (u32 j = 0; j < sizeof(Type); j++)
+            {
+                value |= static_cast<Type>(planes[j * count + i]) << (j * 8);
+            }
+
+            values[i] = delta ? previous + value : value;
+            previous = values[i];
+        }
+
+        return true;
+    }
+
+    template <typename Type>
+    bool validateValues(const u8 *compressedData, u32 compressedSize, u32 count)
+    {
+        return ZSTD_getFrameContentSize(compressedData, compressedSize) == static_cast<u64>(count) * sizeof(Type)
+            && ZSTD_findFrameCompressedSize(compressedData, compressedSize) == compressedSize;
+    }
+
+    template std::vector<u8> compressValues<u32>(const u32 *, u32, bool);
+    template std::vector<u8> compressValues<u64>(const u64 *, u32, bool);
+    template bool decompressValues<u32>(const u8 *, u32, u32 *, u32, bool);
+    template bool decompressValues<u64>(const u8 *, u32, u64 *, u32, bool);
+    template bool validateValues<u32>(const u8 *, u32, u32);
+    template bool validateValues<u64>(const u8 *, u32, u32);
+
     void *decompress(const u8 *compressedData, u32 compressedSize, u32 &size)
     {
         size = ZSTD_getFrameContentSize(compressedData, compressedSize);
@@ -382,4 +706,79 @@ namespace Utilities5
             return initialAdvancesBW2ID(seed);
         }
     }
+
+    void initialAdvances(const u64 *seeds, u8 count, const Profile5 &profile, u32 *advances)
+    {
+        if ((profile.getVersion() & Game::BW) != Game::None)
+        {
+            initialAdvancesBW(seeds, count, advances);
+        }
+        else
+        {
+            initialAdvancesBW2(seeds, count, profile.getMemoryLink(), advances);
+        }
+    }
+
+    void initialAdvancesBW(const u64 *seeds, u8 count, u32 *advances)
+    {
+        computeLanes(seeds, count, 0, advances, [](auto &lanes) {
+            for (u8 i = 0; i < 5; i++)
+            {
+                advanceProbabilityTable(lanes);
+            }
+        });
+    }
+
+    void initialAdvancesBW2(const u64 *seeds, u8 count, bool memory, u32 *advances)
+    {
+        // The advances after the first probability table are the same for every seed
+        computeLanes(seeds, count, memory ? 2 : 3, advances, [memory](auto &lanes) {
+            for (u8 i = 0; i < 5; i++)
+            {
+                advanceProbabilityTable(lanes);
+                if (i == 0)
+                {
+                    lanes.advance(memory ? 2 : 3);
+                }
+            }
+
+            u32 active = 0xf;
+            for (u8 limit = 0; limit < 100 && active != 0; limit++)
+            {
+                active = lanes.drawRepeat(active);
+            }
+        });
+    }
+
+    void initialAdvancesID(const u64 *seeds, u8 count, Game version, u32 *advances)
+    {
+        if ((version & Game::BW) != Game::None)
+        {
+            // 2 advances are done after the probability table
+            computeLanes(seeds, count, 2, advances, [](auto &lanes) {
+                for (u8 i = 0; i < 3; i++)
+                {
+                    advanceProbabilityTable(lanes);
+                }
+            });
+        }
+        else
+        {
+            // See initialAdvancesBW2ID() for where the 10 default advances are done
+            computeLanes(seeds, count, 10, advances, [](auto &lanes) {
+                for (u8 i = 0; i < 3; i++)
+                {
+                    advanceProbabilityTable(lanes);
+                    if (i == 0)
+                    {
+                        lanes.advance(2);
+                    }
+                    else if (i == 1)
+                    {
+                        lanes.advance(4);
+                    }
+                }
+            });
+        }
+    }
 }
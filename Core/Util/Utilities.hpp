@@ -24,6 +24,7 @@
 #include <Core/Parents/PersonalInfo.hpp>
 #include <Core/RNG/LCRNG64.hpp>
 #include <string>
+#include <vector>
 
 class DateTime;
 class Profile5;
@@ -32,6 +33,50 @@ enum class Shiny : u8;
 
 namespace Utilities
 {
+    /**
+     * @brief Compresses the \p values. Each byte of the values is grouped together before compressing, which lets zstd find the
+     * runs of zero bytes left in the upper bytes by delta encoding.
+     *
+     * @tparam Type Value type
+     * @param values Values to compress. Must be sorted if \p delta is set
+     * @param count Number of values
+     * @param delta Whether to store the difference between consecutive values
+     *
+     * @return Compressed data
+     */
+    template <typename Type>
+    std::vector<u8> compressValues(const Type *values, u32 count, bool delta);
+
+    /**
+     * @brief Decompresses values compressed by compressValues()
+     *
+     * @tparam Type Value type
+     * @param compressedData Compressed data
+     * @param compressedSize Size of compressed data
+     * @param values Buffer to store the \p count values in
+     * @param count Number of values
+     * @param delta Whether the values were delta encoded
+     *
+     * @return true Values were decompressed
+     * @return false Compressed data was invalid
+     */
+    template <typename Type>
+    bool decompressValues(const u8 *compressedData, u32 compressedSize, Type *values, u32 count, bool delta);
+
+    /**
+     * @brief Checks the frame header of values compressed by compressValues() without decompressing them
+     *
+     * @tparam Type Value type
+     * @param compressedData Compressed data
+     * @param compressedSize Size of compressed data
+     * @param count Number of values
+     *
+     * @return true Compressed data fills \p compressedSize and holds \p count values
+     * @return false Compressed data was invalid
+     */
+    template <typename Type>
+    bool validateValues(const u8 *compressedData, u32 compressedSize, u32 count);
+
     /**
      * @brief Decompress provided data
      * The caller of this function is responsible for cleaning up the memory.
@@ -274,6 +319,49 @@ namespace Utilities5
      * @return Initial advance count
      */
     u32 initialAdvancesID(u64 seed, Game version);
+
+    /**
+     * @brief Calculates the initial set of advances for the \p profile of each seed.
+     * The seeds are advanced together 4 at a time, using AVX2 when it is available.
+     *
+     * @param seeds PRNG states
+     * @param count Number of PRNG states
+     * @param profile Profile information
+     * @param advances Initial advance count of each seed
+     */
+    void initialAdvances(const u64 *seeds, u8 count, const Profile5 &profile, u32 *advances);
+
+    /**
+     * @brief Calculates the initial set of advances for BW of each seed.
+     * The seeds are advanced together 4 at a time, using AVX2 when it is available.
+     *
+     * @param seeds PRNG states
+     * @param count Number of PRNG states
+     * @param advances Initial advance count of each seed
+     */
+    void initialAdvancesBW(const u64 *seeds, u8 count, u32 *advances);
+
+    /**
+     * @brief Calculates the initial set of advances for BW2 of each seed.
+     * The seeds are advanced together 4 at a time, using AVX2 when it is available.
+     *
+     * @param seeds PRNG states
+     * @param count Number of PRNG states
+     * @param memory Whether memory link is activated
+     * @param advances Initial advance count of each seed
+     */
+    void initialAdvancesBW2(const u64 *seeds, u8 count, bool memory, u32 *advances);
+
+    /**
+     * @brief Calculates the initial set of advances for ID of each seed.
+     * The seeds are advanced together 4 at a time, using AVX2 when it is available.
+     *
+     * @param seeds PRNG states
+     * @param count Number of PRNG states
+     * @param version Game version
+     * @param advances Initial advance count of each seed
+     */
+    void initialAdvancesID(const u64 *seeds, u8 count, Game version, u32 *advances);
 }
 
 #endif // UTILITIES_HPP
@@ -357,7 +357,10 @@ void Wild3::search()
     }
     searcher->setMaxProgress(maxProgress);
 
-    auto *thread = QThread::create([=] { searcher->startSearch(min, max); });
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
+    auto *thread = QThread::create([=] { searcher->startSearch(threads, min, max); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
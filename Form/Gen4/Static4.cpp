@@ -279,7 +279,10 @@ void Static4::search()
     }
     searcher->setMaxProgress(maxProgress);
 
-    auto *thread = QThread::create([=] { searcher->startSearch(min, max, staticTemplate); });
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
+    auto *thread = QThread::create([=] { searcher->startSearch(threads, min, max, staticTemplate); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
@@ -739,7 +739,10 @@ void Wild4::search()
     }
     searcher->setMaxProgress(maxProgress);
 
-    auto *thread = QThread::create([=] { searcher->startSearch(min, max, fixedSlot); });
+    QSettings settings;
+    int threads = settings.value("settings/threads").toInt();
+
+    auto *thread = QThread::create([=] { searcher->startSearch(threads, min, max, fixedSlot); });
     connect(thread, &QThread::finished, thread, &QThread::deleteLater);
     connect(ui->pushButtonCancel, &QPushButton::clicked, [searcher] { searcher->cancelSearch(); });
 
@@ -29,6 +29,7 @@
 #include <Core/Parents/ProfileLoader.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Form/Controls/Controls.hpp>
+#include <Form/Controls/SpillWarning.hpp>
 #include <Form/Gen5/Profile/ProfileManager5.hpp>
 #include <Model/Gen5/DreamRadarModel.hpp>
 #include <Model/SortFilterProxyModel.hpp>
@@ -379,7 +380,9 @@ void DreamRadar::search()
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
         searcherModel->addItems(searcher->getResults());
+        searcherModel->finishModel();
         ui->progressBar->setValue(searcher->getProgress());
+        showSpillWarning(*searcherModel);
         delete searcher;
     });
 
@@ -23,11 +23,12 @@
 #include <Core/Gen5/Generators/EggGenerator5.hpp>
 #include <Core/Gen5/Keypresses.hpp>
 #include <Core/Gen5/Profile5.hpp>
-#include <Core/Gen5/Searchers/Searcher5.hpp>
+#include <Core/Gen5/Searchers/EggSearcher5.hpp>
 #include <Core/Parents/ProfileLoader.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Core/Util/Utilities.hpp>
 #include <Form/Controls/Controls.hpp>
+#include <Form/Controls/SpillWarning.hpp>
 #include <Form/Gen5/Profile/ProfileManager5.hpp>
 #include <Form/Util/AdvanceFinder.hpp>
 #include <Model/Gen5/EggModel5.hpp>
@@ -211,7 +212,7 @@ void Eggs5::search()
 
     auto filter = ui->filterSearcher->getFilter<StateFilter>();
     EggGenerator5 generator(initialAdvances, maxAdvances, 0, daycare, *currentProfile, filter);
-    auto *searcher = new Searcher5<EggGenerator5, EggState5>(generator, *currentProfile);
+    auto *searcher = new EggSearcher5(generator, *currentProfile);
     searcher->setMaxProgress(searcher->getMaxProgress(start, end));
 
     QSettings settings;
@@ -232,7 +233,9 @@ void Eggs5::search()
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
         searcherModel->addItems(searcher->getResults());
+        searcherModel->finishModel();
         ui->progressBar->setValue(searcher->getProgress());
+        showSpillWarning(*searcherModel);
         delete searcher;
     });
 
@@ -31,6 +31,7 @@
 #include <Core/Util/Translator.hpp>
 #include <Core/Util/Utilities.hpp>
 #include <Form/Controls/Controls.hpp>
+#include <Form/Controls/SpillWarning.hpp>
 #include <Form/Gen5/Profile/ProfileManager5.hpp>
 #include <Form/Util/AdvanceFinder.hpp>
 #include <Model/Gen5/EventModel5.hpp>
@@ -327,7 +328,9 @@ void Event5::search()
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
         searcherModel->addItems(searcher->getResults());
+        searcherModel->finishModel();
         ui->progressBar->setValue(searcher->getProgress());
+        showSpillWarning(*searcherModel);
         delete searcher;
     });
 
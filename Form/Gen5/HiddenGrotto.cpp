@@ -34,6 +34,7 @@
 #include <Core/Parents/ProfileLoader.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Form/Controls/Controls.hpp>
+#include <Form/Controls/SpillWarning.hpp>
 #include <Form/Gen5/Profile/ProfileManager5.hpp>
 #include <Form/Gen5/Tools/AdjacentSeeds.hpp>
 #include <Form/Util/AdvanceFinder.hpp>
@@ -375,7 +376,9 @@ void HiddenGrotto::grottoSearch()
         ui->pushButtonGrottoSearch->setEnabled(true);
         ui->pushButtonGrottoCancel->setEnabled(false);
         grottoSearcherModel->addItems(searcher->getResults());
+        grottoSearcherModel->finishModel();
         ui->progressBarGrotto->setValue(searcher->getProgress());
+        showSpillWarning(*grottoSearcherModel);
         delete searcher;
     });
 
@@ -593,23 +596,30 @@ void HiddenGrotto::pokemonSearch()
     auto filter = ui->filterPokemonSearcher->getFilter<StateFilter>();
     HiddenGrottoGenerator generator(initialAdvances, maxAdvances, 0, lead, gender, slot, *currentProfile, filter);
 
-    SearcherBase5<HiddenGrottoGenerator, State5> *searcher;
+    SearcherBase5<HiddenGrottoGenerator, State5> *searcher = nullptr;
     if (fastSearchEnabled())
     {
         auto ivMap = ivCache->getCache(initialIVAdvances, maxIVAdvances, currentProfile->getVersion(), CacheType::Normal, filter);
-        if (shaCache && shaCache->isValid(*currentProfile))
+        if (shaCache && ivCache->isValid() && shaCache->isValid(*currentProfile))
         {
             auto shaMap = shaCache->getCache(initialIVAdvances, maxIVAdvances, start, end, ivMap, CacheType::Normal, *currentProfile);
-            searcher = new IVSearcher5CacheFast<HiddenGrottoGenerator, State5>(initialIVAdvances, maxIVAdvances, shaMap, ivMap, generator,
-                                                                               *currentProfile);
+
+            // Caches that fail to decompress are invalidated, the search then falls back to hashing every seed
+            if (shaCache->isValid())
+            {
+                searcher = new IVSearcher5CacheFast<HiddenGrottoGenerator, State5>(initialIVAdvances, maxIVAdvances, shaMap, ivMap,
+                                                                                   generator, *currentProfile);
+            }
         }
-        else
+
+        if (!searcher && ivCache->isValid())
         {
             searcher
                 = new IVSearcher5Fast<HiddenGrottoGenerator, State5>(initialIVAdvances, maxIVAdvances, ivMap, generator, *currentProfile);
         }
     }
-    else
+
+    if (!searcher)
     {
         searcher = new IVSearcher5<HiddenGrottoGenerator, State5>(initialIVAdvances, maxIVAdvances, generator, *currentProfile);
     }
@@ -634,7 +644,9 @@ void HiddenGrotto::pokemonSearch()
         ui->pushButtonPokemonSearch->setEnabled(true);
         ui->pushButtonPokemonCancel->setEnabled(false);
         pokemonSearcherModel->addItems(searcher->getResults());
+        pokemonSearcherModel->finishModel();
         ui->progressBarPokemon->setValue(searcher->getProgress());
+        showSpillWarning(*pokemonSearcherModel);
         delete searcher;
     });
 
@@ -749,6 +761,11 @@ void HiddenGrotto::profileChanged(const Profile5 &profile)
     if (!ivCachePath.empty())
     {
         ivCache = new IVCache(ivCachePath);
+        if (!ivCache->isValid())
+        {
+            delete ivCache;
+            ivCache = nullptr;
+        }
     }
 
     auto shaCachePath = currentProfile->getSHACache();
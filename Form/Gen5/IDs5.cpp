@@ -28,6 +28,7 @@
 #include <Core/RNG/SHA1.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Core/Util/Utilities.hpp>
+#include <Form/Controls/SpillWarning.hpp>
 #include <Form/Gen5/Profile/ProfileManager5.hpp>
 #include <Model/Gen5/IDModel5.hpp>
 #include <QMessageBox>
@@ -183,7 +184,9 @@ void IDs5::search()
         ui->pushButtonFind->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
         model->addItems(searcher->getResults());
+        model->finishModel();
         ui->progressBar->setValue(searcher->getProgress());
+        showSpillWarning(*model);
         delete searcher;
     });
 
@@ -32,6 +32,7 @@
 #include <Core/Parents/StaticTemplate.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Form/Controls/Controls.hpp>
+#include <Form/Controls/SpillWarning.hpp>
 #include <Form/Gen5/Profile/ProfileManager5.hpp>
 #include <Form/Gen5/Tools/AdjacentSeeds.hpp>
 #include <Form/Util/AdvanceFinder.hpp>
@@ -380,23 +381,30 @@ void Static5::search()
     StaticGenerator5 generator(initialAdvances, maxAdvances, 0, Method::Method5, lead, luckyPower, *staticTemplate, *currentProfile,
                                filter);
 
-    SearcherBase5<StaticGenerator5, State5> *searcher;
+    SearcherBase5<StaticGenerator5, State5> *searcher = nullptr;
     if (fastSearchEnabled())
     {
         CacheType type = staticTemplate->getRoamer() ? CacheType::Roamer : CacheType::Normal;
         auto ivMap = ivCache->getCache(initialIVAdvances, maxIVAdvances, currentProfile->getVersion(), type, filter);
-        if (shaCache && shaCache->isValid(*currentProfile))
+        if (shaCache && ivCache->isValid() && shaCache->isValid(*currentProfile))
         {
             auto shaMap = shaCache->getCache(initialAdvances, maxIVAdvances, start, end, ivMap, type, *currentProfile);
-            searcher = new IVSearcher5CacheFast<StaticGenerator5, State5>(initialIVAdvances, maxIVAdvances, shaMap, ivMap, generator,
-                                                                          *currentProfile);
+
+            // Caches that fail to decompress are invalidated, the search then falls back to hashing every seed
+            if (shaCache->isValid())
+            {
+                searcher = new IVSearcher5CacheFast<StaticGenerator5, State5>(initialIVAdvances, maxIVAdvances, shaMap, ivMap, generator,
+                                                                              *currentProfile);
+            }
         }
-        else
+
+        if (!searcher && ivCache->isValid())
         {
             searcher = new IVSearcher5Fast<StaticGenerator5, State5>(initialIVAdvances, maxIVAdvances, ivMap, generator, *currentProfile);
         }
     }
-    else
+
+    if (!searcher)
     {
         searcher = new IVSearcher5<StaticGenerator5, State5>(initialIVAdvances, maxIVAdvances, generator, *currentProfile);
     }
@@ -421,7 +429,9 @@ void Static5::search()
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
         searcherModel->addItems(searcher->getResults());
+        searcherModel->finishModel();
         ui->progressBar->setValue(searcher->getProgress());
+        showSpillWarning(*searcherModel);
         delete searcher;
     });
 
@@ -57,7 +57,8 @@ void IVCacheFinder::search()
     ui->pushButtonSearch->setEnabled(false);
     ui->pushButtonCancel->setEnabled(true);
 
-    auto *searcher = new IVCacheSearcher(ui->textEditInitialAdvances->getUInt(), ui->textEditMaxAdvances->getUInt());
+    auto *searcher = new IVCacheSearcher(ui->textEditInitialAdvances->getUInt(), ui->textEditMaxAdvances->getUInt(),
+                                         ui->lineEditOutputFile->text().toStdString() + ".checkpoint");
     searcher->setMaxProgress(0x100000000);
 
     QSettings settings;
@@ -75,9 +76,18 @@ void IVCacheFinder::search()
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
         ui->progressBar->setValue(searcher->getProgress());
-        if (!searcher->cancelled())
+        if (searcher->failed())
         {
-            searcher->writeResults(ui->lineEditOutputFile->text().toStdString());            
+            QMessageBox msg(QMessageBox::Warning, tr("Checkpoint error"),
+                            tr("Failed to store search results in the checkpoint file, the cache was not written"));
+            msg.exec();
+        }
+        else if (!searcher->cancelled()
+                 && !searcher->writeResults(ui->lineEditOutputFile->text().toStdString(), ui->checkBoxCompress->isChecked()))
+        {
+            QMessageBox msg(QMessageBox::Warning, tr("Write error"),
+                            tr("Failed to write the cache file, the checkpoint was kept so the cache can be written again"));
+            msg.exec();
         }
         delete searcher;
     });
@@ -117,7 +117,8 @@ void SHA1CacheFinder::search()
     ui->pushButtonSearch->setEnabled(false);
     ui->pushButtonCancel->setEnabled(true);
 
-    auto *searcher = new SHA1CacheSearcher(ivCache, *currentProfile, start, end);
+    auto *searcher
+        = new SHA1CacheSearcher(ivCache, *currentProfile, start, end, ui->lineEditOutputFile->text().toStdString() + ".checkpoint");
     searcher->setMaxProgress(searcher->getMaxProgress());
 
     QSettings settings;
@@ -135,9 +136,18 @@ void SHA1CacheFinder::search()
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
         ui->progressBar->setValue(searcher->getProgress());
-        if (!searcher->cancelled())
+        if (searcher->failed())
         {
-            searcher->writeResults(ui->lineEditOutputFile->text().toStdString());
+            QMessageBox msg(QMessageBox::Warning, tr("Checkpoint error"),
+                            tr("Failed to store search results in the checkpoint file, the cache was not written"));
+            msg.exec();
+        }
+        else if (!searcher->cancelled()
+                 && !searcher->writeResults(ui->lineEditOutputFile->text().toStdString(), ui->checkBoxCompress->isChecked()))
+        {
+            QMessageBox msg(QMessageBox::Warning, tr("Write error"),
+                            tr("Failed to write the cache file, the checkpoint was kept so the cache can be written again"));
+            msg.exec();
         }
         delete searcher;
     });
@@ -34,6 +34,7 @@
 #include <Core/Parents/ProfileLoader.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Form/Controls/Controls.hpp>
+#include <Form/Controls/SpillWarning.hpp>
 #include <Form/Gen5/Profile/ProfileManager5.hpp>
 #include <Form/Gen5/Tools/AdjacentSeeds.hpp>
 #include <Form/Util/AdvanceFinder.hpp>
@@ -346,6 +347,11 @@ void Wild5::profileChanged(const Profile5 &profile)
     if (!ivCachePath.empty())
     {
         ivCache = new IVCache(ivCachePath);
+        if (!ivCache->isValid())
+        {
+            delete ivCache;
+            ivCache = nullptr;
+        }
     }
 
     auto shaCachePath = currentProfile->getSHACache();
@@ -407,22 +413,29 @@ void Wild5::search()
     WildGenerator5 generator(initialAdvances, maxAdvances, 0, Method::Method5, lead, luckyPower,
                              encounterSearcher[ui->comboBoxSearcherLocation->currentIndex()], *currentProfile, filter);
 
-    SearcherBase5<WildGenerator5, WildState5> *searcher;
+    SearcherBase5<WildGenerator5, WildState5> *searcher = nullptr;
     if (fastSearchEnabled())
     {
         auto ivMap = ivCache->getCache(initialIVAdvances, maxIVAdvances, currentProfile->getVersion(), CacheType::Normal, filter);
-        if (shaCache && shaCache->isValid(*currentProfile))
+        if (shaCache && ivCache->isValid() && shaCache->isValid(*currentProfile))
         {
             auto shaMap = shaCache->getCache(initialIVAdvances, maxIVAdvances, start, end, ivMap, CacheType::Normal, *currentProfile);
-            searcher = new IVSearcher5CacheFast<WildGenerator5, WildState5>(initialIVAdvances, maxIVAdvances, shaMap, ivMap, generator,
-                                                                            *currentProfile);
+
+            // Caches that fail to decompress are invalidated, the search then falls back to hashing every seed
+            if (shaCache->isValid())
+            {
+                searcher = new IVSearcher5CacheFast<WildGenerator5, WildState5>(initialIVAdvances, maxIVAdvances, shaMap, ivMap, generator,
+                                                                                *currentProfile);
+            }
         }
-        else
+
+        if (!searcher && ivCache->isValid())
         {
             searcher = new IVSearcher5Fast<WildGenerator5, WildState5>(initialIVAdvances, maxIVAdvances, ivMap, generator, *currentProfile);
         }
     }
-    else
+
+    if (!searcher)
     {
         searcher = new IVSearcher5<WildGenerator5, WildState5>(initialIVAdvances, maxIVAdvances, generator, *currentProfile);
     }
@@ -447,7 +460,9 @@ void Wild5::search()
         ui->pushButtonSearch->setEnabled(true);
         ui->pushButtonCancel->setEnabled(false);
         searcherModel->addItems(searcher->getResults());
+        searcherModel->finishModel();
         ui->progressBar->setValue(searcher->getProgress());
+        showSpillWarning(*searcherModel);
         delete searcher;
     });
 
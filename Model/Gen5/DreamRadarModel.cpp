@@ -96,7 +96,8 @@ void DreamRadarGeneratorModel5::setShowStats(bool flag)
     emit dataChanged(index(0, 6), index(rowCount() - 1, 11), { Qt::DisplayRole });
 }
 
-DreamRadarSearcherModel5::DreamRadarSearcherModel5(QObject *parent) : TableModel(parent), showStats(false)
+DreamRadarSearcherModel5::DreamRadarSearcherModel5(QObject *parent) :
+    SpillTableModel(parent, &SearcherState5<DreamRadarState>::compare), showStats(false)
 {
 }
 
@@ -109,7 +110,7 @@ QVariant DreamRadarSearcherModel5::data(const QModelIndex &index, int role) cons
 {
     if (role == Qt::DisplayRole)
     {
-        const auto &display = model[index.row()];
+        auto display = getItem(index.row());
         const auto &state = display.getState();
         int column = index.column();
         switch (column)
@@ -22,6 +22,7 @@
 
 #include <Core/Gen5/States/DreamRadarState.hpp>
 #include <Core/Gen5/States/SearcherState5.hpp>
+#include <Model/SpillTableModel.hpp>
 #include <Model/TableModel.hpp>
 
 /**
@@ -86,7 +87,7 @@ private:
 /**
  * @brief Provides a table model implementation to show dream radar encounter information for Gen 5
  */
-class DreamRadarSearcherModel5 : public TableModel<SearcherState5<DreamRadarState>>
+class DreamRadarSearcherModel5 : public SpillTableModel<SearcherState5<DreamRadarState>>
 {
     Q_OBJECT
 public:
@@ -114,7 +114,8 @@ void EggGeneratorModel5::setShowStats(bool flag)
     emit dataChanged(index(0, 7), index(rowCount() - 1, 12), { Qt::DisplayRole });
 }
 
-EggSearcherModel5::EggSearcherModel5(QObject *parent) : TableModel(parent), showInheritance(false), showStats(false)
+EggSearcherModel5::EggSearcherModel5(QObject *parent) :
+    SpillTableModel(parent, &SearcherState5<EggState5>::compare), showInheritance(false), showStats(false)
 {
 }
 int EggSearcherModel5::columnCount(const QModelIndex &parent) const
@@ -126,7 +127,7 @@ QVariant EggSearcherModel5::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        const auto &display = model[index.row()];
+        auto display = getItem(index.row());
         const auto &state = display.getState();
         int column = index.column();
         switch (column)
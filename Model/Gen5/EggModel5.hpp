@@ -23,6 +23,7 @@
 #include <Core/Gen5/States/EggState5.hpp>
 #include <Core/Gen5/States/SearcherState5.hpp>
 #include <Model/Gen5/IRNGProvider5.hpp>
+#include <Model/SpillTableModel.hpp>
 #include <Model/TableModel.hpp>
 
 /**
@@ -115,7 +116,7 @@ private:
 /**
  * @brief Provides a table model implementation to show egg encounter information for Gen 5
  */
-class EggSearcherModel5 : public TableModel<SearcherState5<EggState5>>
+class EggSearcherModel5 : public SpillTableModel<SearcherState5<EggState5>>
 {
     Q_OBJECT
 public:
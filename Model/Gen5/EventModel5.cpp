@@ -100,7 +100,7 @@ void EventGeneratorModel5::setShowStats(bool flag)
     emit dataChanged(index(0, 7), index(rowCount() - 1, 12), { Qt::DisplayRole });
 }
 
-EventSearcherModel5::EventSearcherModel5(QObject *parent) : TableModel(parent), showStats(false)
+EventSearcherModel5::EventSearcherModel5(QObject *parent) : SpillTableModel(parent, &SearcherState5<EventState5>::compare), showStats(false)
 {
 }
 
@@ -113,7 +113,7 @@ QVariant EventSearcherModel5::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        const auto &display = model[index.row()];
+        auto display = getItem(index.row());
         const auto &state = display.getState();
         int column = index.column();
         switch (column)
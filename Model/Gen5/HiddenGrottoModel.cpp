@@ -72,7 +72,8 @@ QVariant HiddenGrottoSlotGeneratorModel5::headerData(int section, Qt::Orientatio
     return QVariant();
 }
 
-HiddenGrottoSlotSearcherModel5::HiddenGrottoSlotSearcherModel5(QObject *parent) : TableModel(parent)
+HiddenGrottoSlotSearcherModel5::HiddenGrottoSlotSearcherModel5(QObject *parent) :
+    SpillTableModel(parent, &SearcherState5<HiddenGrottoState>::compare)
 {
 }
 
@@ -85,7 +86,7 @@ QVariant HiddenGrottoSlotSearcherModel5::data(const QModelIndex &index, int role
 {
     if (role == Qt::DisplayRole)
     {
-        const auto &display = model[index.row()];
+        auto display = getItem(index.row());
         const auto &state = display.getState();
         int column = index.column();
         switch (column)
@@ -209,7 +210,8 @@ void HiddenGrottoGeneratorModel5::setShowStats(bool flag)
     emit dataChanged(index(0, 8), index(rowCount() - 1, 13), { Qt::DisplayRole });
 }
 
-HiddenGrottoSearcherModel5::HiddenGrottoSearcherModel5(QObject *parent) : TableModel(parent), showStats(false)
+HiddenGrottoSearcherModel5::HiddenGrottoSearcherModel5(QObject *parent) :
+    SpillTableModel(parent, &SearcherState5<State5>::compare), showStats(false)
 {
 }
 
@@ -222,7 +224,7 @@ QVariant HiddenGrottoSearcherModel5::data(const QModelIndex &index, int role) co
 {
     if (role == Qt::DisplayRole)
     {
-        const auto &display = model[index.row()];
+        auto display = getItem(index.row());
         const auto &state = display.getState();
         int column = index.column();
         switch (column)
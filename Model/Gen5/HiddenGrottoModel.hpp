@@ -24,6 +24,7 @@
 #include <Core/Gen5/States/SearcherState5.hpp>
 #include <Core/Gen5/States/State5.hpp>
 #include <Model/Gen5/IRNGProvider5.hpp>
+#include <Model/SpillTableModel.hpp>
 #include <Model/TableModel.hpp>
 
 /**
@@ -97,7 +98,7 @@ private:
 /**
  * @brief Provides a table model implementation to show hidden grotto information for Gen 5
  */
-class HiddenGrottoSlotSearcherModel5 : public TableModel<SearcherState5<HiddenGrottoState>>
+class HiddenGrottoSlotSearcherModel5 : public SpillTableModel<SearcherState5<HiddenGrottoState>>
 {
     Q_OBJECT
 public:
@@ -224,7 +225,7 @@ private:
 /**
  * @brief Provides a table model implementation to show hidden grotto pokemon information for Gen 5
  */
-class HiddenGrottoSearcherModel5 : public TableModel<SearcherState5<State5>>
+class HiddenGrottoSearcherModel5 : public SpillTableModel<SearcherState5<State5>>
 {
     Q_OBJECT
 public:
@@ -22,7 +22,7 @@
 #include <Core/Util/Translator.hpp>
 #include <Core/Util/Utilities.hpp>
 
-IDModel5::IDModel5(QObject *parent) : TableModel(parent), version(Game::Black)
+IDModel5::IDModel5(QObject *parent) : SpillTableModel(parent, &SearcherState5<IDState>::compare), version(Game::Black)
 {
 }
 
@@ -35,7 +35,7 @@ QVariant IDModel5::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        const auto &display = model[index.row()];
+        auto display = getItem(index.row());
         const auto &state = display.getState();
         switch (index.column())
         {
@@ -22,14 +22,14 @@
 
 #include <Core/Gen5/States/SearcherState5.hpp>
 #include <Core/Parents/States/IDState.hpp>
-#include <Model/TableModel.hpp>
+#include <Model/SpillTableModel.hpp>
 
 enum class Game : u32;
 
 /**
  * @brief Provides a table model implementation to show TID/SID information for Gen 5
  */
-class IDModel5 : public TableModel<SearcherState5<IDState>>
+class IDModel5 : public SpillTableModel<SearcherState5<IDState>>
 {
     Q_OBJECT
 public:
@@ -100,7 +100,7 @@ void StaticGeneratorModel5::setShowStats(bool flag)
     emit dataChanged(index(0, 7), index(rowCount() - 1, 12), { Qt::DisplayRole });
 }
 
-StaticSearcherModel5::StaticSearcherModel5(QObject *parent) : TableModel(parent), showStats(false)
+StaticSearcherModel5::StaticSearcherModel5(QObject *parent) : SpillTableModel(parent, &SearcherState5<State5>::compare), showStats(false)
 {
 }
 
@@ -113,7 +113,7 @@ QVariant StaticSearcherModel5::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        const auto &display = model[index.row()];
+        auto display = getItem(index.row());
         const auto &state = display.getState();
         int column = index.column();
         switch (column)
@@ -23,6 +23,7 @@
 #include <Core/Gen5/States/SearcherState5.hpp>
 #include <Core/Gen5/States/State5.hpp>
 #include <Model/Gen5/IRNGProvider5.hpp>
+#include <Model/SpillTableModel.hpp>
 #include <Model/TableModel.hpp>
 
 /**
@@ -107,7 +108,7 @@ private:
 /**
  * @brief Provides a table model implementation to show static encounter information for Gen 5
  */
-class StaticSearcherModel5 : public TableModel<SearcherState5<State5>>
+class StaticSearcherModel5 : public SpillTableModel<SearcherState5<State5>>
 {
     Q_OBJECT
 public:
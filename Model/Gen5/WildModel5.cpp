@@ -108,7 +108,7 @@ void WildGeneratorModel5::setShowStats(bool flag)
     emit dataChanged(index(0, 10), index(rowCount() - 1, 15), { Qt::DisplayRole });
 }
 
-WildSearcherModel5::WildSearcherModel5(QObject *parent) : TableModel(parent), showStats(false)
+WildSearcherModel5::WildSearcherModel5(QObject *parent) : SpillTableModel(parent, &SearcherState5<WildState5>::compare), showStats(false)
 {
 }
 
@@ -121,7 +121,7 @@ QVariant WildSearcherModel5::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        const auto &display = model[index.row()];
+        auto display = getItem(index.row());
         const auto &state = display.getState();
         int column = index.column();
         switch (column)
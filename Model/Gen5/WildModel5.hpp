@@ -23,6 +23,7 @@
 #include <Core/Gen5/States/SearcherState5.hpp>
 #include <Core/Gen5/States/WildState5.hpp>
 #include <Model/Gen5/IRNGProvider5.hpp>
+#include <Model/SpillTableModel.hpp>
 #include <Model/TableModel.hpp>
 
 /**
@@ -107,7 +108,7 @@ private:
 /**
  * @brief Provides a table model implementation to show wild encounter information for Gen 5
  */
-class WildSearcherModel5 : public TableModel<SearcherState5<WildState5>>
+class WildSearcherModel5 : public SpillTableModel<SearcherState5<WildState5>>
 {
     Q_OBJECT
 public:
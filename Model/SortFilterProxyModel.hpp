@@ -20,10 +20,12 @@
 #ifndef SORTFILTERPROXYMODEL_HPP
 #define SORTFILTERPROXYMODEL_HPP
 
+#include <Model/SpillTableModel.hpp>
 #include <QSortFilterProxyModel>
 
 /**
- * @brief Provides a proxy to sort/filter data from a table model
+ * @brief Provides a proxy to sort/filter data from a table model. Sorting reads every row, so it is turned off once a
+ * \ref SpillTableModel moves its rows to a temporary file.
  */
 class SortFilterProxyModel : public QSortFilterProxyModel
 {
@@ -37,6 +39,34 @@ public:
     SortFilterProxyModel(QObject *parent, QAbstractItemModel *model) : QSortFilterProxyModel(parent)
     {
         setSourceModel(model);
+        if (auto *spill = dynamic_cast<SpillModel *>(model))
+        {
+            // Drop the sort before the rows are inserted so the new rows are not sorted in from the temporary file
+            spill->setSpillHandler([this] { QSortFilterProxyModel::sort(-1); });
+        }
+    }
+
+    /**
+     * @brief Destroy the SortFilterProxyModel object
+     */
+    ~SortFilterProxyModel() override
+    {
+        if (auto *spill = dynamic_cast<SpillModel *>(sourceModel()))
+        {
+            spill->setSpillHandler(nullptr);
+        }
+    }
+
+    /**
+     * @brief Sorts by \p column unless the source model has spilled, in which case the sort is removed
+     *
+     * @param column Column to sort by
+     * @param order Sort order
+     */
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override
+    {
+        auto *spill = dynamic_cast<const SpillModel *>(sourceModel());
+        QSortFilterProxyModel::sort(spill && spill->isSpilled() ? -1 : column, order);
     }
 };
 
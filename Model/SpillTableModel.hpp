@@ -0,0 +1,194 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SPILLTABLEMODEL_HPP
+#define SPILLTABLEMODEL_HPP
+
+#include <Core/Parents/Searchers/ResultSpill.hpp>
+#include <QAbstractTableModel>
+#include <functional>
+#include <limits>
+
+/**
+ * @brief Provides the spill state of a \ref SpillTableModel without knowing its item type
+ */
+class SpillModel
+{
+public:
+    /**
+     * @brief Destroy the SpillModel object
+     */
+    virtual ~SpillModel() = default;
+
+    /**
+     * @brief Returns if reading or writing the temporary file failed
+     *
+     * @return true Temporary file failed
+     * @return false Temporary file is intact
+     */
+    virtual bool failed() const = 0;
+
+    /**
+     * @brief Returns if any items have been moved to the temporary file
+     *
+     * @return true Items were spilled
+     * @return false All items are in memory
+     */
+    virtual bool isSpilled() const = 0;
+
+    /**
+     * @brief Sets the function that is called before the first items are moved to the temporary file
+     *
+     * @param handler Function to call, or nullptr to remove it
+     */
+    void setSpillHandler(std::function<void()> handler)
+    {
+        spillHandler = std::move(handler);
+    }
+
+protected:
+    std::function<void()> spillHandler;
+};
+
+/**
+ * @brief Provides a templated table model for search results that can grow past the available memory. Items past the memory
+ * budget are moved to a temporary file and read back one page at a time when they are displayed. Views show at most INT_MAX rows.
+ */
+template <class Item>
+class SpillTableModel : public QAbstractTableModel, public SpillModel
+{
+public:
+    /**
+     * @brief Construct a new SpillTableModel object
+     *
+     * @param parent Parent object, which takes memory ownership
+     * @param compare Ordering of the items once the search is finished, or nullptr to keep the order they were added in
+     */
+    SpillTableModel(QObject *parent = nullptr, typename ResultSpill<Item>::Compare compare = nullptr) :
+        QAbstractTableModel(parent), model(budget, compare)
+    {
+    }
+
+    /**
+     * @brief Add a collection of \p items to the model
+     *
+     * @param items Vector of items to add
+     */
+    void addItems(const std::vector<Item> &items)
+    {
+        if (!items.empty())
+        {
+            if (spillHandler && model.willSpill(items.size()))
+            {
+                spillHandler();
+            }
+
+            // Rows past INT_MAX are kept but can not be shown
+            constexpr u64 max = std::numeric_limits<int>::max();
+            u64 first = model.size();
+            if (first >= max)
+            {
+                model.add(items);
+                return;
+            }
+
+            u64 last = std::min(first + items.size(), max) - 1;
+            beginInsertRows(QModelIndex(), static_cast<int>(first), static_cast<int>(last));
+            model.add(items);
+            endInsertRows();
+        }
+    }
+
+    /**
+     * @brief Removes all items from the model
+     */
+    void clearModel()
+    {
+        if (model.size() != 0)
+        {
+            beginRemoveRows(QModelIndex(), 0, rowCount() - 1);
+            model.clear();
+            endRemoveRows();
+        }
+    }
+
+    /**
+     * @brief Returns if reading or writing the temporary file failed
+     *
+     * @return true Temporary file failed
+     * @return false Temporary file is intact
+     */
+    bool failed() const override
+    {
+        return model.failed();
+    }
+
+    /**
+     * @brief Puts the items in order once the search is finished
+     */
+    void finishModel()
+    {
+        beginResetModel();
+        model.finish();
+        endResetModel();
+    }
+
+    /**
+     * @brief Returns the item from the \p row
+     *
+     * @param row Row to get
+     *
+     * @return Item data of the model
+     */
+    Item getItem(int row) const
+    {
+        return model.get(row);
+    }
+
+    /**
+     * @brief Returns if any items have been moved to the temporary file
+     *
+     * @return true Items were spilled
+     * @return false All items are in memory
+     */
+    bool isSpilled() const override
+    {
+        return model.isSpilled();
+    }
+
+    /**
+     * @brief Returns the number of rows in the model
+     *
+     * @param parent Unused parent index
+     *
+     * @return Number of rows
+     */
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return static_cast<int>(std::min<u64>(model.size(), std::numeric_limits<int>::max()));
+    }
+
+protected:
+    ResultSpill<Item> model;
+
+private:
+    static constexpr u64 budget = 64 * 1024 * 1024;
+};
+
+#endif // SPILLTABLEMODEL_HPP
@@ -78,7 +78,7 @@ void StaticSearcher3Test::search()
     StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
     StaticSearcher3 searcher(method, profile, filter);
 
-    searcher.startSearch(min, max, staticTemplate);
+    searcher.startSearch(4, min, max, staticTemplate);
     auto states = searcher.getResults();
     QCOMPARE(states.size(), results);
 
@@ -106,7 +106,7 @@ void WildSearcher3Test::search()
     WildStateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers, encounterSlots);
     WildSearcher3 searcher(method, lead, settings.feebasTile, bike, item, *encounterArea, profile, filter);
 
-    searcher.startSearch(min, max);
+    searcher.startSearch(4, min, max);
     auto states = searcher.getResults();
     QCOMPARE(states.size(), results);
 
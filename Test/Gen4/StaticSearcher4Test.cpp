@@ -94,7 +94,7 @@ void StaticSearcher4Test::searchMethod1()
     StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
     StaticSearcher4 searcher(minAdvance, maxAdvance, minDelay, maxDelay, Method::Method1, Lead::None, profile, filter);
 
-    searcher.startSearch(min, max, staticTemplate);
+    searcher.startSearch(4, min, max, staticTemplate);
     auto states = searcher.getResults();
     QCOMPARE(states.size(), results);
 
@@ -159,7 +159,7 @@ void StaticSearcher4Test::searchMethodJ()
     StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
     StaticSearcher4 searcher(minAdvance, maxAdvance, minDelay, maxDelay, Method::MethodJ, lead, profile, filter);
 
-    searcher.startSearch(min, max, staticTemplate);
+    searcher.startSearch(4, min, max, staticTemplate);
     auto states = searcher.getResults();
     QCOMPARE(states.size(), results);
 
@@ -225,7 +225,7 @@ void StaticSearcher4Test::searchMethodK()
     StateFilter filter(255, 255, 255, 1, 100, 0, 255, 0, 255, false, min, max, natures, powers);
     StaticSearcher4 searcher(minAdvance, maxAdvance, minDelay, maxDelay, Method::MethodK, lead, profile, filter);
 
-    searcher.startSearch(min, max, staticTemplate);
+    searcher.startSearch(4, min, max, staticTemplate);
     auto states = searcher.getResults();
     QCOMPARE(states.size(), results);
 
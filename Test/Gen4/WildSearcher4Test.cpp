@@ -113,7 +113,7 @@ void WildSearcher4Test::searchMethodJ()
     WildSearcher4 searcher(minAdvance, maxAdvance, minDelay, maxDelay, Method::MethodJ, lead, settings.dppt.feebasTile, false, false, 50,
                            *encounterArea, profile, filter);
 
-    searcher.startSearch(min, max, 0);
+    searcher.startSearch(4, min, max, 0);
     auto states = searcher.getResults();
     QCOMPARE(states.size(), results);
 
@@ -193,7 +193,7 @@ void WildSearcher4Test::searchMethodK()
     WildSearcher4 searcher(minAdvance, maxAdvance, minDelay, maxDelay, Method::MethodK, lead, false, false, false, 50, *encounterArea,
                            profile, filter);
 
-    searcher.startSearch(min, max, 0);
+    searcher.startSearch(4, min, max, 0);
     auto states = searcher.getResults();
     QCOMPARE(states.size(), results);
 
@@ -269,7 +269,7 @@ void WildSearcher4Test::searchHoneyTree()
     WildSearcher4 searcher(minAdvance, maxAdvance, minDelay, maxDelay, Method::HoneyTree, lead, settings.dppt.feebasTile, false, false, 50,
                            *encounterArea, profile, filter);
 
-    searcher.startSearch(min, max, index);
+    searcher.startSearch(4, min, max, index);
     auto states = searcher.getResults();
     QCOMPARE(states.size(), results);
 
@@ -350,7 +350,7 @@ void WildSearcher4Test::searchPokeRadar()
     WildSearcher4 searcher(minAdvance, maxAdvance, minDelay, maxDelay, Method::PokeRadar, lead, false, shiny, false, 50, *encounterArea,
                            profile, filter);
 
-    searcher.startSearch(min, max, index);
+    searcher.startSearch(4, min, max, index);
     auto states = searcher.getResults();
     QCOMPARE(states.size(), results);
 
@@ -40,6 +40,17 @@ static bool operator==(const EggState5 &left, const json &right)
         && left.getChatot() == right["chatot"].get<u8>();
 }
 
+static bool operator==(const EggState5 &left, const EggState5 &right)
+{
+    return left.getPID() == right.getPID() && left.getStats() == right.getStats() && left.getAbilityIndex() == right.getAbilityIndex()
+        && left.getIVs() == right.getIVs() && left.getAbility() == right.getAbility()
+        && left.getCharacteristic() == right.getCharacteristic() && left.getGender() == right.getGender()
+        && left.getHiddenPower() == right.getHiddenPower() && left.getHiddenPowerStrength() == right.getHiddenPowerStrength()
+        && left.getLevel() == right.getLevel() && left.getNature() == right.getNature() && left.getShiny() == right.getShiny()
+        && left.getInheritance() == right.getInheritance() && left.getAdvances() == right.getAdvances()
+        && left.getChatot() == right.getChatot();
+}
+
 void EggGenerator5Test::generate_data()
 {
     QTest::addColumn<u64>("seed");
@@ -103,4 +114,38 @@ void EggGenerator5Test::generate()
         const auto &state = states[i];
         QVERIFY(state == j[i]);
     }
+
+    // Batched MT and initial advances used by EggSearcher5
+    generator.generate(&seed, 1, &states);
+    QCOMPARE(states.size(), j.size());
+
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        const auto &state = states[i];
+        QVERIFY(state == j[i]);
+    }
+
+    // Full batch and a batch ending in a partial vector, each seed has to match generating it on its own
+    std::array<u64, 16> seeds;
+    for (u8 i = 0; i < seeds.size(); i++)
+    {
+        seeds[i] = seed + 0x9e3779b97f4a7c15 * i;
+    }
+
+    for (u8 count : { 16, 13 })
+    {
+        std::array<std::vector<EggState5>, 16> batch;
+        generator.generate(seeds.data(), count, batch.data());
+
+        for (u8 i = 0; i < count; i++)
+        {
+            auto expected = generator.generate(seeds[i]);
+            QCOMPARE(batch[i].size(), expected.size());
+
+            for (size_t k = 0; k < expected.size(); k++)
+            {
+                QVERIFY(batch[i][k] == expected[k]);
+            }
+        }
+    }
 }
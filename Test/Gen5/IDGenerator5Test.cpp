@@ -22,6 +22,7 @@
 #include <Core/Gen5/Generators/IDGenerator5.hpp>
 #include <Core/Gen5/Profile5.hpp>
 #include <Core/Parents/States/IDState.hpp>
+#include <Core/Util/Utilities.hpp>
 #include <QTest>
 #include <Test/Data.hpp>
 #include <Test/Enum.hpp>
@@ -68,4 +69,34 @@ void IDGenerator5Test::generate()
         const auto &state = states[i];
         QVERIFY(state == j[i]);
     }
+
+    // Batched initial advances used by IDSearcher5
+    u32 advances;
+    Utilities5::initialAdvancesID(&seed, 1, version, &advances);
+    states = generator.generate(seed, advances);
+    QCOMPARE(states.size(), j.size());
+
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        const auto &state = states[i];
+        QVERIFY(state == j[i]);
+    }
+
+    // Full batch and a batch ending in a partial vector, each seed has to match computing it on its own
+    std::array<u64, 16> seeds;
+    for (u8 i = 0; i < seeds.size(); i++)
+    {
+        seeds[i] = seed + 0x9e3779b97f4a7c15 * i;
+    }
+
+    for (u8 count : { 16, 13 })
+    {
+        std::array<u32, 16> batch;
+        Utilities5::initialAdvancesID(seeds.data(), count, version, batch.data());
+
+        for (u8 i = 0; i < count; i++)
+        {
+            QCOMPARE(batch[i], Utilities5::initialAdvancesID(seeds[i], version));
+        }
+    }
 }
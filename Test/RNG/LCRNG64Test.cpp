@@ -19,6 +19,7 @@
 
 #include "LCRNG64Test.hpp"
 #include <Core/RNG/LCRNG64.hpp>
+#include <Core/RNG/SIMD.hpp>
 #include <QTest>
 #include <Test/Data.hpp>
 
@@ -49,6 +50,48 @@ void LCRNG64Test::advance()
     QCOMPARE(bwrngr.advance(advances), results[1]);
 }
 
+void LCRNG64Test::advanceMulti_data()
+{
+    advance_data();
+}
+
+void LCRNG64Test::advanceMulti()
+{
+    QFETCH(u64, seed);
+    QFETCH(u32, advances);
+    QFETCH(std::vector<u64>, results);
+
+#ifdef SIMD_X86
+    if (!hasAVX2())
+    {
+        QSKIP("AVX2 is not available");
+    }
+
+    // Each lane has to match advancing its seed on its own, the first lane also has to match the expected result
+    std::array<u64, 4> seeds = { seed, seed + 1, ~seed, seed * 0x9e3779b97f4a7c15 };
+    BWRNGMulti multi(seeds.data());
+    multi.advance(advances);
+    QCOMPARE(multi.getSeed().uint64[0], results[0]);
+    for (u8 i = 0; i < 4; i++)
+    {
+        BWRNG bwrng(seeds[i]);
+        QCOMPARE(multi.getSeed().uint64[i], bwrng.advance(advances));
+    }
+
+    // Only the lanes in the mask advance
+    vuint256 mask;
+    mask.uint256 = _mm256_set_epi64x(0, -1, 0, -1);
+    vuint256 next = multi.next(mask);
+    for (u8 i = 0; i < 4; i++)
+    {
+        BWRNG bwrng(seeds[i]);
+        QCOMPARE(next.uint64[i], bwrng.advance(advances + (i % 2 == 0 ? 1 : 0)));
+    }
+#else
+    QSKIP("SIMD is not enabled");
+#endif
+}
+
 void LCRNG64Test::distance_data()
 {
     QTest::addColumn<u64>("start");
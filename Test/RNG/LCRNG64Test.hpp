@@ -29,6 +29,9 @@ private slots:
     void advance_data();
     void advance();
 
+    void advanceMulti_data();
+    void advanceMulti();
+
     void distance_data();
     void distance();
 
@@ -80,6 +80,44 @@ void LCRNGReverseTest::recoverPokeRNGIV()
     }
 }
 
+void LCRNGReverseTest::recoverPokeRNGIVRange_data()
+{
+    recoverPokeRNGIV_data();
+}
+
+void LCRNGReverseTest::recoverPokeRNGIVRange()
+{
+    QFETCH(Method, method);
+    QFETCH(std::vector<u8>, ivs);
+    QFETCH(std::vector<u32>, results);
+
+    u32 seeds[32 * 6];
+    u8 counts[32];
+    int total = LCRNGReverse::recoverPokeRNGIV(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], 0, 31, method, seeds, counts);
+
+    int offset = 0;
+    for (u8 spe = 0; spe < 32; spe++)
+    {
+        auto expected = LCRNGReverse::recoverPokeRNGIV(ivs[0], ivs[1], ivs[2], ivs[3], ivs[4], spe, method);
+        QCOMPARE(counts[spe], expected.count);
+        for (int i = 0; i < expected.count; i++)
+        {
+            QCOMPARE(seeds[offset + i], expected[i]);
+        }
+
+        if (spe == ivs[5])
+        {
+            QCOMPARE(counts[spe], results.size());
+            for (int i = 0; i < counts[spe]; i++)
+            {
+                QCOMPARE(seeds[offset + i], results[i]);
+            }
+        }
+        offset += counts[spe];
+    }
+    QCOMPARE(total, offset);
+}
+
 void LCRNGReverseTest::recoverPokeRNGPID_data()
 {
     QTest::addColumn<Method>("method");
@@ -32,6 +32,9 @@ private slots:
     void recoverPokeRNGIV_data();
     void recoverPokeRNGIV();
 
+    void recoverPokeRNGIVRange_data();
+    void recoverPokeRNGIVRange();
+
     void recoverPokeRNGPID_data();
     void recoverPokeRNGPID();
 
@@ -31,6 +31,7 @@
 using KeyPresses = std::array<bool, 9>;
 using SeedSSE = std::array<u64, 4>;
 using SeedAVX2 = std::array<u64, 8>;
+using SeedAVX512 = std::array<u64, 16>;
 
 void SHA1Test::hash_data()
 {
@@ -380,3 +381,126 @@ void SHA1AVX2Test::hashTime()
     }
 #endif
 }
+
+void SHA1AVX512Test::hash_data()
+{
+    QTest::addColumn<KeyPresses>("keypresses");
+    QTest::addColumn<bool>("skipLR");
+    QTest::addColumn<Game>("version");
+    QTest::addColumn<Language>("language");
+    QTest::addColumn<u64>("mac");
+    QTest::addColumn<u8>("vFrame");
+    QTest::addColumn<u8>("gxStat");
+    QTest::addColumn<u32>("timer0");
+    QTest::addColumn<u8>("vCount");
+    QTest::addColumn<DSType>("dsType");
+    QTest::addColumn<SeedAVX512>("seed");
+
+    json data = readData("sha1avx512", "hash");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["keypresses"].get<KeyPresses>() << d["skipLR"].get<bool>() << d["version"].get<Game>() << d["language"].get<Language>()
+            << d["mac"].get<u64>() << d["vFrame"].get<u8>() << d["gxStat"].get<u8>() << d["timer0"].get<u32>() << d["vCount"].get<u8>()
+            << d["dsType"].get<DSType>() << d["seed"].get<SeedAVX512>();
+    }
+}
+
+void SHA1AVX512Test::hash()
+{
+    QFETCH(KeyPresses, keypresses);
+    QFETCH(bool, skipLR);
+    QFETCH(Game, version);
+    QFETCH(Language, language);
+    QFETCH(u64, mac);
+    QFETCH(u8, vFrame);
+    QFETCH(u8, gxStat);
+    QFETCH(u32, timer0);
+    QFETCH(u8, vCount);
+    QFETCH(DSType, dsType);
+    QFETCH(SeedAVX512, seed);
+
+#ifdef SIMD_X86
+    if (hasAVX512())
+    {
+        Profile5 profile("-", version, 0, 0, "", "", mac, keypresses, vCount, gxStat, vFrame, skipLR, timer0, timer0, false, false, dsType,
+                         language);
+
+        auto buttons = Keypresses::getKeypresses(profile);
+
+        DateTime dateTime;
+        const Date &date = dateTime.getDate();
+        const Time &time = dateTime.getTime();
+
+        SHA1AVX512 sha(profile);
+        sha.setButton(buttons.front().value);
+        sha.setDate(date);
+        sha.setTime(time.hour(), time.minute(), time.second(), profile.getDSType());
+        sha.setTimer0(profile.getTimer0Min(), profile.getVCount());
+
+        auto alpha = sha.precompute();
+        QCOMPARE(sha.hashSeed(alpha), seed);
+    }
+#endif
+}
+
+void SHA1AVX512Test::hashTime_data()
+{
+    QTest::addColumn<KeyPresses>("keypresses");
+    QTest::addColumn<bool>("skipLR");
+    QTest::addColumn<Game>("version");
+    QTest::addColumn<Language>("language");
+    QTest::addColumn<u64>("mac");
+    QTest::addColumn<u8>("vFrame");
+    QTest::addColumn<u8>("gxStat");
+    QTest::addColumn<u32>("timer0");
+    QTest::addColumn<u8>("vCount");
+    QTest::addColumn<DSType>("dsType");
+    QTest::addColumn<SeedAVX512>("seed");
+
+    json data = readData("sha1avx512", "hashTime");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["keypresses"].get<KeyPresses>() << d["skipLR"].get<bool>() << d["version"].get<Game>() << d["language"].get<Language>()
+            << d["mac"].get<u64>() << d["vFrame"].get<u8>() << d["gxStat"].get<u8>() << d["timer0"].get<u32>() << d["vCount"].get<u8>()
+            << d["dsType"].get<DSType>() << d["seed"].get<SeedAVX512>();
+    }
+}
+
+void SHA1AVX512Test::hashTime()
+{
+    QFETCH(KeyPresses, keypresses);
+    QFETCH(bool, skipLR);
+    QFETCH(Game, version);
+    QFETCH(Language, language);
+    QFETCH(u64, mac);
+    QFETCH(u8, vFrame);
+    QFETCH(u8, gxStat);
+    QFETCH(u32, timer0);
+    QFETCH(u8, vCount);
+    QFETCH(DSType, dsType);
+    QFETCH(SeedAVX512, seed);
+
+#ifdef SIMD_X86
+    if (hasAVX512())
+    {
+        Profile5 profile("-", version, 0, 0, "", "", mac, keypresses, vCount, gxStat, vFrame, skipLR, timer0, timer0, false, false, dsType,
+                         language);
+
+        auto buttons = Keypresses::getKeypresses(profile);
+
+        Date date;
+        Time time(12, 0, 0);
+
+        SHA1AVX512 sha(profile);
+        sha.setButton(buttons.front().value);
+        sha.setDate(date);
+        sha.setTime(time.hour(), time.minute(), time.second(), profile.getDSType());
+        sha.setTimer0(profile.getTimer0Min(), profile.getVCount());
+
+        auto alpha = sha.precompute();
+        QCOMPARE(sha.hashSeed(alpha), seed);
+    }
+#endif
+}
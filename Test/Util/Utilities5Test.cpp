@@ -0,0 +1,126 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2024 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Utilities5Test.hpp"
+#include <Core/Enum/DSType.hpp>
+#include <Core/Enum/Game.hpp>
+#include <Core/Enum/Language.hpp>
+#include <Core/Gen5/Profile5.hpp>
+#include <Core/Util/Utilities.hpp>
+#include <QTest>
+#include <Test/Data.hpp>
+#include <Test/Enum.hpp>
+
+/**
+ * @brief Spreads 16 seeds out from \p seed
+ *
+ * @param seed First seed
+ *
+ * @return Seeds
+ */
+static std::array<u64, 16> getSeeds(u64 seed)
+{
+    std::array<u64, 16> seeds;
+    for (u8 i = 0; i < seeds.size(); i++)
+    {
+        seeds[i] = seed + 0x9e3779b97f4a7c15 * i;
+    }
+    return seeds;
+}
+
+void Utilities5Test::initialAdvances_data()
+{
+    QTest::addColumn<u64>("seed");
+    QTest::addColumn<Game>("version");
+    QTest::addColumn<bool>("memoryLink");
+    QTest::addColumn<u8>("count");
+
+    json data = readData("utilities5", "initialAdvances");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data())
+            << d["seed"].get<u64>() << d["version"].get<Game>() << d["memoryLink"].get<bool>() << d["count"].get<u8>();
+    }
+}
+
+void Utilities5Test::initialAdvances()
+{
+    QFETCH(u64, seed);
+    QFETCH(Game, version);
+    QFETCH(bool, memoryLink);
+    QFETCH(u8, count);
+
+    Profile5 profile("-", version, 12345, 54321, "", "", 0, { false, false, false, false, false, false, false, false, false }, 0, 0, 0,
+                     false, 0, 0, memoryLink, false, DSType::DS, Language::English);
+
+    auto seeds = getSeeds(seed);
+
+    std::array<u32, 16> advances;
+    Utilities5::initialAdvances(seeds.data(), count, profile, advances.data());
+    for (u8 i = 0; i < count; i++)
+    {
+        QCOMPARE(advances[i], Utilities5::initialAdvances(seeds[i], profile));
+    }
+
+    if ((version & Game::BW) != Game::None)
+    {
+        Utilities5::initialAdvancesBW(seeds.data(), count, advances.data());
+        for (u8 i = 0; i < count; i++)
+        {
+            QCOMPARE(advances[i], Utilities5::initialAdvancesBW(seeds[i]));
+        }
+    }
+    else
+    {
+        Utilities5::initialAdvancesBW2(seeds.data(), count, memoryLink, advances.data());
+        for (u8 i = 0; i < count; i++)
+        {
+            QCOMPARE(advances[i], Utilities5::initialAdvancesBW2(seeds[i], memoryLink));
+        }
+    }
+}
+
+void Utilities5Test::initialAdvancesID_data()
+{
+    QTest::addColumn<u64>("seed");
+    QTest::addColumn<Game>("version");
+    QTest::addColumn<u8>("count");
+
+    json data = readData("utilities5", "initialAdvancesID");
+    for (const auto &d : data)
+    {
+        QTest::newRow(d["name"].get<std::string>().data()) << d["seed"].get<u64>() << d["version"].get<Game>() << d["count"].get<u8>();
+    }
+}
+
+void Utilities5Test::initialAdvancesID()
+{
+    QFETCH(u64, seed);
+    QFETCH(Game, version);
+    QFETCH(u8, count);
+
+    auto seeds = getSeeds(seed);
+
+    std::array<u32, 16> advances;
+    Utilities5::initialAdvancesID(seeds.data(), count, version, advances.data());
+    for (u8 i = 0; i < count; i++)
+    {
+        QCOMPARE(advances[i], Utilities5::initialAdvancesID(seeds[i], version));
+    }
+}
@@ -68,6 +68,7 @@
 #include <Test/Util/EncounterSlotTest.hpp>
 #include <Test/Util/IVCheckerTest.hpp>
 #include <Test/Util/IVToPIDCalculatorTest.hpp>
+#include <Test/Util/Utilities5Test.hpp>
 
 template <class Testname>
 int runTest(QStringList &fails)
@@ -140,6 +141,7 @@ int main()
     status += runTest<SFMTTest>(fails);
     status += runTest<SHA1Test>(fails);
     status += runTest<SHA1AVX2Test>(fails);
+    status += runTest<SHA1AVX512Test>(fails);
     status += runTest<SHA1SSETest>(fails);
     status += runTest<TinyMTTest>(fails);
     status += runTest<XoroshiroTest>(fails);
@@ -153,6 +155,7 @@ int main()
     status += runTest<EncounterSlotTest>(fails);
     status += runTest<IVCheckerTest>(fails);
     status += runTest<IVToPIDCalculatorTest>(fails);
+    status += runTest<Utilities5Test>(fails);
 
     qDebug() << "";
     // Summary of failures at end for easy viewing